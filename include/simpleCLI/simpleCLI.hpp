@@ -4,3 +4,6 @@
 #include "../../simpleCli/errors.hpp"
 #include "../../simpleCli/arguments.hpp"
 #include "../../simpleCli/parser.hpp"
+#include "../../simpleCli/reloadable.hpp"
+#include "../../simpleCli/schema.hpp"
+#include "../../simpleCli/staticParser.hpp"
@@ -13,6 +13,30 @@
 
 namespace simpleCli{ // #SCOPE: simpleCli
 
+// #SCOPE: Argument
+
+// #DIV: Public Methods
+
+    // #FUNCTION: index(), Const Method
+    std::size_t Argument::index()const{
+        return m_index;
+    } // #END: index()
+
+    // #FUNCTION: setIndex(const std::size_t), Method
+    void Argument::setIndex(const std::size_t p_index){
+        m_index = p_index;
+    } // #END: setIndex(const std::size_t)
+
+// #DIV: Private Static Methods
+
+    // #FUNCTION: elementError(Error&&, const std::size_t), Static Method
+    Error Argument::elementError(Error&& p_error, const std::size_t p_offset){
+        p_error.offset = p_offset; // Keeps the converter's type and the element as body
+        return std::move(p_error);
+    } // #END: elementError(Error&&, const std::size_t)
+
+// #END: Argument
+
 // #SCOPE: Bindable
 
 // #DIV: Public Methods
@@ -22,6 +46,11 @@ namespace simpleCli{ // #SCOPE: simpleCli
         return true;
     } // #END: takesValue()
 
+    // #FUNCTION: reset(), Virtual Method
+    void Bindable::reset(){
+        // Nothing carried between parses by default
+    } // #END: reset()
+
 // #END: Bindable
 
 // #SCOPE: Callable
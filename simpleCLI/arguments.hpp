@@ -10,7 +10,18 @@
 
 namespace simpleCli{ // #SCOPE: simpleCli
 
-    MODULE_EXPORT template<class T_Arg> using Converter = std::function<std::expected<T_Arg, Error>(const std::string&)>;
+    // #CLASS: ViewConverter, Final Class
+    // Converter slot of std::string_view and const char* binds, which always view the parsed value and take no converter
+    MODULE_EXPORT class ViewConverter final{
+    public:
+    // Public Factory Methods
+        ViewConverter() = default;
+        template<class T_Callable> requires std::invocable<const T_Callable&, const std::string&> ViewConverter(const T_Callable& p_callable);
+    // Public Methods
+        explicit operator bool()const noexcept;
+    }; // #END: ViewConverter
+
+    MODULE_EXPORT template<class T_Arg> using Converter = std::conditional_t<std::same_as<T_Arg, std::string_view> || std::same_as<T_Arg, const char*>, ViewConverter, std::function<std::expected<T_Arg, Error>(const std::string&)>>;
 
     // #CLASS: Argument, Abstract Class
     MODULE_EXPORT class Argument{
@@ -26,13 +37,33 @@ namespace simpleCli{ // #SCOPE: simpleCli
             CONTINUOUS_OPTION,
             COMMAND,
             POSITIONAL,
+            STREAMED_POSITIONAL,
+            POSITIONAL_SOURCE,
             PROGRAM
         };
     // Public Static Methods
         template<class T_Arg> static std::expected<T_Arg, Error> convert(const std::string& p_value);
+        template<class T_Arg> static std::expected<T_Arg, Error> convertView(const std::string_view p_value);
+        template<class T_Arg> static Converter<T_Arg> bindConverter();
+        template<class T_Arg> static Converter<std::vector<T_Arg>> listConverter(const char p_delimiter = LIST_DELIMITER, const Converter<T_Arg>& p_converter = &Argument::convert<T_Arg>);
+        template<class T_Arg> static Converter<std::set<T_Arg>> setConverter(const char p_delimiter = LIST_DELIMITER, const Converter<T_Arg>& p_converter = &Argument::convert<T_Arg>);
+        template<class T_Key, class T_Value> static Converter<std::unordered_map<T_Key, T_Value>> mapConverter(const char p_delimiter = LIST_DELIMITER, const char p_separator = MAP_SEPARATOR, const Converter<T_Key>& p_keyConverter = &Argument::convert<T_Key>, const Converter<T_Value>& p_valueConverter = &Argument::convert<T_Value>);
     // Public Methods
         virtual Type type()const = 0;
         virtual bool takesValue()const = 0;
+        std::size_t index()const;
+        void setIndex(const std::size_t p_index);
+    // Public Members
+        static inline constexpr char LIST_DELIMITER = ',';
+        static inline constexpr char MAP_SEPARATOR = '=';
+        static inline constexpr std::string_view STANDARD_INPUT = "-";
+    private:
+    // Private Static Methods
+        static Error elementError(Error&& p_error, const std::size_t p_offset);
+        template<class T_Call> static std::expected<void, Error> split(const std::string_view p_value, const char p_delimiter, T_Call&& p_call);
+        template<class T_Arg, class T_Insert> static std::expected<void, Error> convertElements(const std::string& p_value, const char p_delimiter, const Converter<T_Arg>& p_converter, T_Insert&& p_insert);
+    // Private Members
+        std::size_t m_index = 0; // Constraint bit, shared by tags registered together
     }; // #END: Argument
 
     // #CLASS: Bindable, Abstract Class
@@ -42,10 +73,25 @@ namespace simpleCli{ // #SCOPE: simpleCli
         Bindable() = default;
         virtual ~Bindable() = default;
     // Public Methods
-        virtual std::expected<void, Error> bind(const std::string& p_bind) = 0;
+        virtual std::expected<void, Error> bind(const std::string_view p_bind) = 0;
+        virtual void reset();
         bool takesValue()const override;
+    protected:
+    // Protected Static Methods
+        template<class T_Bind> static std::expected<T_Bind, Error> convertValue(const std::string_view p_value, const Converter<T_Bind>& p_converter);
     }; // #END: Bindable
 
+    // #CLASS: Bound<T_Bind>, Template Abstract Class
+    // Exposes the values an argument bound in the current parse, used by value constraints
+    MODULE_EXPORT template<class T_Bind> class Bound{
+    public:
+    // Public Factory Methods
+        Bound() = default;
+        virtual ~Bound() = default;
+    // Public Methods
+        virtual bool checkBound(const std::function<bool(const T_Bind&)>& p_check)const = 0;
+    }; // #END: Bound<T_Bind>
+
     // #CLASS: Callable, Abstract Class
     MODULE_EXPORT class Callable: public Argument{
     public:
@@ -87,14 +133,15 @@ namespace simpleCli{ // #SCOPE: simpleCli
     }; // #END: Flag
 
     // #CLASS: Option<T_Bind>, Template Final Class
-    MODULE_EXPORT template<class T_Bind> class Option final: public Bindable{
+    MODULE_EXPORT template<class T_Bind> class Option final: public Bindable, public Bound<T_Bind>{
     public:
     // Public Factory Methods
         Option(T_Bind* const p_bind, const Converter<T_Bind>& p_converter);
         Option(T_Bind* const p_bind, Converter<T_Bind>&& p_converter);
     // Public Methods
         Type type()const override;
-        std::expected<void, Error> bind(const std::string& p_bind)override;
+        bool checkBound(const std::function<bool(const T_Bind&)>& p_check)const override;
+        std::expected<void, Error> bind(const std::string_view p_bind)override;
     private:
     // Private Members
         T_Bind* m_bind; // External bind
@@ -102,14 +149,15 @@ namespace simpleCli{ // #SCOPE: simpleCli
     }; // #END: Option<T_Bind>
 
     // #CLASS: RepeatableOption<T_Bind>, Template Final Class
-    MODULE_EXPORT template<class T_Bind> class RepeatableOption final: public Bindable{
+    MODULE_EXPORT template<class T_Bind> class RepeatableOption final: public Bindable, public Bound<T_Bind>{
     public:
     // Public Factory Methods
         RepeatableOption(std::vector<T_Bind>* const p_bind, const Converter<T_Bind>& p_converter);
         RepeatableOption(std::vector<T_Bind>* const p_bind, Converter<T_Bind>&& p_converter);
     // Public Methods
         Type type()const override;
-        std::expected<void, Error> bind(const std::string& p_bind)override;
+        bool checkBound(const std::function<bool(const T_Bind&)>& p_check)const override;
+        std::expected<void, Error> bind(const std::string_view p_bind)override;
     private:
     // Private Members
         std::vector<T_Bind>* m_bind; // External bind
@@ -117,14 +165,15 @@ namespace simpleCli{ // #SCOPE: simpleCli
     }; // #END: RepeatableOption<T_Bind>
 
     // #CLASS: ContinuousOption<T_Bind>, Template Final Class
-    MODULE_EXPORT template<class T_Bind> class ContinuousOption final: public Bindable{
+    MODULE_EXPORT template<class T_Bind> class ContinuousOption final: public Bindable, public Bound<T_Bind>{
     public:
     // Public Factory Methods
         ContinuousOption(std::vector<T_Bind>* const p_bind, const Converter<T_Bind>& p_converter);
         ContinuousOption(std::vector<T_Bind>* const p_bind, Converter<T_Bind>&& p_converter);
     // Public Methods
         Type type()const override;
-        std::expected<void, Error> bind(const std::string& p_bind)override;
+        bool checkBound(const std::function<bool(const T_Bind&)>& p_check)const override;
+        std::expected<void, Error> bind(const std::string_view p_bind)override;
     private:
     // Private Members
         std::vector<T_Bind>* m_bind; // External bind
@@ -153,13 +202,104 @@ namespace simpleCli{ // #SCOPE: simpleCli
         Positional(std::vector<T_Bind>* const p_bind, Converter<T_Bind>&& p_converter);
     // Public Methods
         Type type()const override;
-        std::expected<void, Error> bind(const std::string& p_bind)override;
+        std::expected<void, Error> bind(const std::string_view p_bind)override;
     private:
     // Private Members
         std::vector<T_Bind>* m_bind; // External bind
         Converter<T_Bind> m_converter; // Arg value converter
     }; // #END: Positional<T_Bind>
 
+    // #CLASS: PositionalStream<T_Bind>, Template Final Class
+    MODULE_EXPORT template<class T_Bind> class PositionalStream final{
+    public:
+    // Public Types
+        class Iterator;
+    // Public Factory Methods
+        PositionalStream() = default;
+        PositionalStream(const PositionalStream&) = delete;
+        PositionalStream& operator=(const PositionalStream&) = delete;
+    // Public Methods
+        Iterator begin();
+        std::default_sentinel_t end()const;
+        void addArgument(const std::string_view p_argument);
+        void addFile(const std::string& p_path);
+        void addStandardInput();
+    private:
+    // Private Types
+        struct Source{
+            enum class Type: std::uint8_t{
+                ARGUMENT,
+                FILE,
+                STANDARD_INPUT
+            };
+            Type type;
+            std::string_view value; // Argv entry, or a path owned by m_paths
+        };
+    // Private Methods
+        void next();
+        void closeInput();
+        void reset();
+    // Private Members
+        std::vector<Source> m_sources; // Pending sources in command line order
+        std::deque<std::string> m_paths; // Owned file paths, a deque keeps views into them stable
+        std::size_t m_position = 0; // Next source to open
+        std::istream* m_input = nullptr; // Source currently read line by line
+        std::ifstream m_file; // Open file source
+        std::string m_line; // Reused line buffer
+        std::optional<std::expected<T_Bind, Error>> m_current; // Last pulled item
+        bool m_started = false;
+        Converter<T_Bind> m_converter; // Item converter
+    // Friends
+        friend class StreamedPositional<T_Bind>;
+    }; // #END: PositionalStream<T_Bind>
+
+    // #CLASS: PositionalStream<T_Bind>::Iterator, Template Final Class
+    MODULE_EXPORT template<class T_Bind> class PositionalStream<T_Bind>::Iterator final{
+    public:
+    // Public Types
+        using value_type = std::expected<T_Bind, Error>;
+        using difference_type = std::ptrdiff_t;
+    // Public Factory Methods
+        Iterator() = default;
+        Iterator(PositionalStream<T_Bind>* const p_stream);
+    // Public Methods
+        const value_type& operator*()const;
+        Iterator& operator++();
+        void operator++(int);
+        bool operator==(std::default_sentinel_t)const;
+    private:
+    // Private Members
+        PositionalStream<T_Bind>* m_stream = nullptr; // Iterated stream
+    }; // #END: PositionalStream<T_Bind>::Iterator
+
+    // #CLASS: StreamedPositional<T_Bind>, Template Final Class
+    MODULE_EXPORT template<class T_Bind> class StreamedPositional final: public Bindable{
+    public:
+    // Public Factory Methods
+        StreamedPositional(PositionalStream<T_Bind>* const p_bind, const Converter<T_Bind>& p_converter);
+        StreamedPositional(PositionalStream<T_Bind>* const p_bind, Converter<T_Bind>&& p_converter);
+    // Public Methods
+        Type type()const override;
+        std::expected<void, Error> bind(const std::string_view p_bind)override;
+        void reset()override;
+    private:
+    // Private Members
+        PositionalStream<T_Bind>* m_bind; // External bind
+    }; // #END: StreamedPositional<T_Bind>
+
+    // #CLASS: PositionalSource<T_Bind>, Template Final Class
+    MODULE_EXPORT template<class T_Bind> class PositionalSource final: public Bindable{
+    public:
+    // Public Factory Methods
+        PositionalSource(PositionalStream<T_Bind>* const p_bind);
+    // Public Methods
+        Type type()const override;
+        std::expected<void, Error> bind(const std::string_view p_bind)override;
+    private:
+    // Private Members
+        PositionalStream<T_Bind>* m_bind; // External bind
+    }; // #END: PositionalSource<T_Bind>
+
     // #CLASS: Program<T_Bind>, Template Final Class
     MODULE_EXPORT template<class T_Bind> class Program final: public Bindable{
     public:
@@ -168,13 +308,60 @@ namespace simpleCli{ // #SCOPE: simpleCli
         Program(T_Bind* const p_bind, Converter<T_Bind>&& p_converter);
     // Public Methods
         Type type()const override;
-        std::expected<void, Error> bind(const std::string& p_bind)override;
+        std::expected<void, Error> bind(const std::string_view p_bind)override;
     private:
     // Private Members
         T_Bind* m_bind; // External bind
         Converter<T_Bind> m_converter; // Arg value converter
     }; // #END: Program<T_Bind>
 
+    // #CLASS: FieldFlag<T_Config>, Template Final Class
+    MODULE_EXPORT template<class T_Config> class FieldFlag final: public Flaggable{
+    public:
+    // Public Factory Methods
+        FieldFlag(T_Config* const* const p_target, bool T_Config::* const p_member);
+    // Public Methods
+        Type type()const override;
+        void flag()override;
+        void callback()override;
+    private:
+    // Private Members
+        T_Config* const* m_target; // Current parse target
+        bool T_Config::* m_member; // Bound field
+    }; // #END: FieldFlag<T_Config>
+
+    // #CLASS: FieldOption<T_Config, T_Bind>, Template Final Class
+    MODULE_EXPORT template<class T_Config, class T_Bind> class FieldOption final: public Bindable, public Bound<T_Bind>{
+    public:
+    // Public Factory Methods
+        FieldOption(T_Config* const* const p_target, T_Bind T_Config::* const p_member, const Converter<T_Bind>& p_converter);
+    // Public Methods
+        Type type()const override;
+        std::expected<void, Error> bind(const std::string_view p_bind)override;
+        bool checkBound(const std::function<bool(const T_Bind&)>& p_check)const override;
+    private:
+    // Private Members
+        T_Config* const* m_target; // Current parse target
+        T_Bind T_Config::* m_member; // Bound field
+        Converter<T_Bind> m_converter; // Arg value converter
+    }; // #END: FieldOption<T_Config, T_Bind>
+
+    // #CLASS: FieldRepeatableOption<T_Config, T_Bind>, Template Final Class
+    MODULE_EXPORT template<class T_Config, class T_Bind> class FieldRepeatableOption final: public Bindable, public Bound<T_Bind>{
+    public:
+    // Public Factory Methods
+        FieldRepeatableOption(T_Config* const* const p_target, std::vector<T_Bind> T_Config::* const p_member, const Converter<T_Bind>& p_converter);
+    // Public Methods
+        Type type()const override;
+        std::expected<void, Error> bind(const std::string_view p_bind)override;
+        bool checkBound(const std::function<bool(const T_Bind&)>& p_check)const override;
+    private:
+    // Private Members
+        T_Config* const* m_target; // Current parse target
+        std::vector<T_Bind> T_Config::* m_member; // Bound field
+        Converter<T_Bind> m_converter; // Arg value converter
+    }; // #END: FieldRepeatableOption<T_Config, T_Bind>
+
 } // #END: simpleCli
 
 #undef MODULE_EXPORT
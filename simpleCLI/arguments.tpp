@@ -9,13 +9,35 @@ namespace simpleCli{ // #SCOPE: simpleCli
     template<class>
     inline constexpr bool dependent_false = false;
 
+// #SCOPE: ViewConverter
+
+// #DIV: Public Factory Methods
+
+    // #FUNCTION: ViewConverter<T_Callable>(const T_Callable&), Template Constructor
+    template<class T_Callable> requires std::invocable<const T_Callable&, const std::string&> ViewConverter::ViewConverter(const T_Callable&){
+        static_assert(dependent_false<T_Callable>, "View binds point straight into argv and never call a converter, bind a std::string to convert or validate the value");
+    } // #END: ViewConverter<T_Callable>(const T_Callable&)
+
+// #DIV: Public Methods
+
+    // #FUNCTION: operator bool(), Inline Const Noexcept Method
+    inline ViewConverter::operator bool()const noexcept{
+        return true; // Viewing the value needs nothing to be set
+    } // #END: operator bool()
+
+// #END: ViewConverter
+
 // #SCOPE: Argument
 
 // #DIV: Public Static Methods
 
     // #FUNCTION: convert<T_Arg>(const std::string&), Template Method
     template<class T_Arg> std::expected<T_Arg, Error> Argument::convert(const std::string& p_value){
-        static_assert(dependent_false<T_Arg>, "Unsupported type, must provide a conversion function to use this type");
+        if constexpr(std::same_as<T_Arg, std::string_view> || std::same_as<T_Arg, const char*>){
+            static_assert(dependent_false<T_Arg>, "View types would point into the converted string, bind them directly from argv instead");
+        }else{
+            static_assert(dependent_false<T_Arg>, "Unsupported type, must provide a conversion function to use this type");
+        }
     } // #END: convert<T_Arg>(const std::string&)
 
     // #FUNCTION: convert<std::string>(const std::string&), Inline Specialized Template Method
@@ -56,8 +78,182 @@ namespace simpleCli{ // #SCOPE: simpleCli
         }
     } // #END: convert<float>(const std::string&)
 
+    // #FUNCTION: convertView<T_Arg>(const std::string_view), Template Method
+    template<class T_Arg> std::expected<T_Arg, Error> Argument::convertView(const std::string_view p_value){
+        static_assert(dependent_false<T_Arg>, "Unsupported type, must provide an allocation free conversion function to use this type");
+    } // #END: convertView<T_Arg>(const std::string_view)
+
+    // #FUNCTION: convertView<std::string_view>(const std::string_view), Inline Specialized Template Method
+    template<> inline std::expected<std::string_view, Error> Argument::convertView(const std::string_view p_value){
+        return p_value;
+    } // #END: convertView<std::string_view>(const std::string_view)
+
+    // #FUNCTION: convertView<const char*>(const std::string_view), Inline Specialized Template Method
+    template<> inline std::expected<const char*, Error> Argument::convertView(const std::string_view p_value){
+        return p_value.data(); // Parser values are whole argv entries or their suffix after '=', so null terminated
+    } // #END: convertView<const char*>(const std::string_view)
+
+    // #FUNCTION: convertView<char>(const std::string_view), Inline Specialized Template Method
+    template<> inline std::expected<char, Error> Argument::convertView(const std::string_view p_value){
+        if(p_value.size() != 1){
+            return std::unexpected<Error>({Error::Type::CHAR_CONVERSION_FAILURE, std::string(p_value)});
+        }
+        return p_value[0];
+    } // #END: convertView<char>(const std::string_view)
+
+    // #FUNCTION: convertView<int>(const std::string_view), Inline Specialized Template Method
+    template<> inline std::expected<int, Error> Argument::convertView(const std::string_view p_value){
+        int value = 0;
+        const char* const end = p_value.data() + p_value.size();
+        if(auto [last, error] = std::from_chars(p_value.data(), end, value); error != std::errc() || last != end){
+            return std::unexpected<Error>({Error::Type::INT_CONVERSION_FAILURE, std::string(p_value)});
+        }
+        return value;
+    } // #END: convertView<int>(const std::string_view)
+
+    // #FUNCTION: convertView<float>(const std::string_view), Inline Specialized Template Method
+    template<> inline std::expected<float, Error> Argument::convertView(const std::string_view p_value){
+        float value = 0.0f;
+        const char* const end = p_value.data() + p_value.size();
+        if(auto [last, error] = std::from_chars(p_value.data(), end, value); error != std::errc() || last != end){
+            return std::unexpected<Error>({Error::Type::FLOAT_CONVERSION_FAILURE, std::string(p_value)});
+        }
+        return value;
+    } // #END: convertView<float>(const std::string_view)
+
+    // #FUNCTION: bindConverter<T_Arg>(), Template Static Method
+    template<class T_Arg> Converter<T_Arg> Argument::bindConverter(){
+        if constexpr(std::same_as<T_Arg, std::string_view> || std::same_as<T_Arg, const char*>){
+            return ViewConverter(); // Bindable::convertValue views argv or parser owned tokens directly
+        }else{
+            return &Argument::convert<T_Arg>;
+        }
+    } // #END: bindConverter<T_Arg>()
+
+    // #FUNCTION: listConverter<T_Arg>(const char, const Converter<T_Arg>&), Template Static Method
+    template<class T_Arg> Converter<std::vector<T_Arg>> Argument::listConverter(const char p_delimiter, const Converter<T_Arg>& p_converter){
+        return [p_delimiter, p_converter](const std::string& p_value)->std::expected<std::vector<T_Arg>, Error>{
+            std::vector<T_Arg> list;
+            list.reserve(std::count(p_value.begin(), p_value.end(), p_delimiter) + 1); // One allocation for all elements
+            if(auto result = convertElements<T_Arg>(p_value, p_delimiter, p_converter, [&list](T_Arg&& p_element){
+                list.push_back(std::move(p_element));
+            }); !result){
+                return std::unexpected<Error>(result.error());
+            }
+            return list;
+        };
+    } // #END: listConverter<T_Arg>(const char, const Converter<T_Arg>&)
+
+    // #FUNCTION: setConverter<T_Arg>(const char, const Converter<T_Arg>&), Template Static Method
+    template<class T_Arg> Converter<std::set<T_Arg>> Argument::setConverter(const char p_delimiter, const Converter<T_Arg>& p_converter){
+        return [p_delimiter, p_converter](const std::string& p_value)->std::expected<std::set<T_Arg>, Error>{
+            std::set<T_Arg> set;
+            if(auto result = convertElements<T_Arg>(p_value, p_delimiter, p_converter, [&set](T_Arg&& p_element){
+                set.insert(std::move(p_element));
+            }); !result){
+                return std::unexpected<Error>(result.error());
+            }
+            return set;
+        };
+    } // #END: setConverter<T_Arg>(const char, const Converter<T_Arg>&)
+
+    // #FUNCTION: mapConverter<T_Key, T_Value>(const char, const char, const Converter<T_Key>&, const Converter<T_Value>&), Template Static Method
+    template<class T_Key, class T_Value> Converter<std::unordered_map<T_Key, T_Value>> Argument::mapConverter(const char p_delimiter, const char p_separator, const Converter<T_Key>& p_keyConverter, const Converter<T_Value>& p_valueConverter){
+        return [p_delimiter, p_separator, p_keyConverter, p_valueConverter](const std::string& p_value)->std::expected<std::unordered_map<T_Key, T_Value>, Error>{
+            if(!p_keyConverter || !p_valueConverter){
+                return std::unexpected<Error>({Error::Type::NULL_BIND_OR_CONVERTER, p_value});
+            }
+            std::unordered_map<T_Key, T_Value> map;
+            map.reserve(std::count(p_value.begin(), p_value.end(), p_delimiter) + 1);
+            std::string key; // Reused key buffer
+            std::string value; // Reused value buffer
+            if(auto result = split(p_value, p_delimiter, [&](const std::string_view p_pair, const std::size_t p_offset)->std::expected<void, Error>{
+                const char* separator = static_cast<const char*>(std::memchr(p_pair.data(), p_separator, p_pair.size()));
+                if(!separator){ // Pair without separator
+                    return std::unexpected<Error>({Error::Type::INVALID_KEY_VALUE_PAIR, p_value, p_offset});
+                }
+                const std::size_t keySize = separator - p_pair.data();
+                key.assign(p_pair.data(), keySize);
+                value.assign(separator + 1, p_pair.size() - keySize - 1);
+                auto convertedKey = p_keyConverter(key);
+                if(!convertedKey){
+                    return std::unexpected<Error>(elementError(std::move(convertedKey.error()), p_offset));
+                }
+                auto convertedValue = p_valueConverter(value);
+                if(!convertedValue){
+                    return std::unexpected<Error>(elementError(std::move(convertedValue.error()), p_offset + keySize + 1));
+                }
+                map.insert_or_assign(std::move(convertedKey.value()), std::move(convertedValue.value()));
+                return {}; // Success return void
+            }); !result){
+                return std::unexpected<Error>(result.error());
+            }
+            return map;
+        };
+    } // #END: mapConverter<T_Key, T_Value>(const char, const char, const Converter<T_Key>&, const Converter<T_Value>&)
+
+// #DIV: Private Static Methods
+
+    // #FUNCTION: split<T_Call>(const std::string_view, const char, T_Call&&), Template Static Method
+    template<class T_Call> std::expected<void, Error> Argument::split(const std::string_view p_value, const char p_delimiter, T_Call&& p_call){
+        if(p_value.empty()){ // No elements
+            return {};
+        }
+        const char* const begin = p_value.data();
+        const char* const end = begin + p_value.size();
+        const char* position = begin;
+        while(true){
+            // memchr is vectorized by the C library, scanning many bytes per step
+            const char* next = static_cast<const char*>(std::memchr(position, p_delimiter, end - position));
+            if(!next){ // Last element
+                next = end;
+            }
+            if(auto result = p_call(std::string_view(position, next - position), static_cast<std::size_t>(position - begin)); !result){
+                return result;
+            }
+            if(next == end){
+                return {}; // Success return void
+            }
+            position = next + 1;
+        }
+    } // #END: split<T_Call>(const std::string_view, const char, T_Call&&)
+
+    // #FUNCTION: convertElements<T_Arg, T_Insert>(const std::string&, const char, const Converter<T_Arg>&, T_Insert&&), Template Static Method
+    template<class T_Arg, class T_Insert> std::expected<void, Error> Argument::convertElements(const std::string& p_value, const char p_delimiter, const Converter<T_Arg>& p_converter, T_Insert&& p_insert){
+        if(!p_converter){
+            return std::unexpected<Error>({Error::Type::NULL_BIND_OR_CONVERTER, p_value});
+        }
+        std::string element; // Reused element buffer, grows once to the longest element
+        return split(p_value, p_delimiter, [&](const std::string_view p_element, const std::size_t p_offset)->std::expected<void, Error>{
+            element.assign(p_element);
+            if(auto result = p_converter(element); result){
+                p_insert(std::move(result.value()));
+                return {}; // Success return void
+            }else{
+                return std::unexpected<Error>(elementError(std::move(result.error()), p_offset));
+            }
+        });
+    } // #END: convertElements<T_Arg, T_Insert>(const std::string&, const char, const Converter<T_Arg>&, T_Insert&&)
+
 // #END: Argument
 
+// #SCOPE: Bindable
+
+// #DIV: Protected Static Methods
+
+    // #FUNCTION: convertValue<T_Bind>(const std::string_view, const Converter<T_Bind>&), Template Static Method
+    template<class T_Bind> std::expected<T_Bind, Error> Bindable::convertValue(const std::string_view p_value, const Converter<T_Bind>& p_converter){
+        if constexpr(std::same_as<T_Bind, std::string_view>){
+            return p_value; // Points into argv, no copy
+        }else if constexpr(std::same_as<T_Bind, const char*>){
+            return p_value.data(); // Parser values are whole argv entries or their suffix after '=', so null terminated
+        }else{
+            return p_converter(std::string(p_value));
+        }
+    } // #END: convertValue<T_Bind>(const std::string_view, const Converter<T_Bind>&)
+
+// #END: Bindable
+
 // #SCOPE: Option<T_Bind>
 
 // #DIV: Public Factory Methods
@@ -81,19 +277,24 @@ namespace simpleCli{ // #SCOPE: simpleCli
         return Type::OPTION;
     } // #END: type()
 
-    // #FUNCTION: bind(const std::string&), Override Method
-    template<class T_Bind> std::expected<void, Error> Option<T_Bind>::bind(const std::string& p_bind){
+    // #FUNCTION: checkBound(const std::function<bool(const T_Bind&)>&), Const Override Method
+    template<class T_Bind> bool Option<T_Bind>::checkBound(const std::function<bool(const T_Bind&)>& p_check)const{
+        return !m_bind || p_check(*m_bind);
+    } // #END: checkBound(const std::function<bool(const T_Bind&)>&)
+
+    // #FUNCTION: bind(const std::string_view), Override Method
+    template<class T_Bind> std::expected<void, Error> Option<T_Bind>::bind(const std::string_view p_bind){
         if(m_bind && m_converter){
-            if(auto result = m_converter(p_bind); result){
+            if(auto result = convertValue<T_Bind>(p_bind, m_converter); result){
                 *m_bind = result.value();
                 return {}; // Success return void
             }else{
                 return std::unexpected<Error>(result.error());
             }
         }else{
-            return std::unexpected<Error>({Error::Type::NULL_BIND_OR_CONVERTER, p_bind});
+            return std::unexpected<Error>({Error::Type::NULL_BIND_OR_CONVERTER, std::string(p_bind)});
         }
-    } // #END: bind(const std::string&)
+    } // #END: bind(const std::string_view)
 
 // #END: Option<T_Bind>
 
@@ -121,19 +322,29 @@ namespace simpleCli{ // #SCOPE: simpleCli
         return Type::REPEATABLE_OPTION;
     } // #END: type()
 
-    // #FUNCTION: bind(const std::string&), Override Method
-    template<class T_Bind> std::expected<void, Error> RepeatableOption<T_Bind>::bind(const std::string& p_bind){
+    // #FUNCTION: checkBound(const std::function<bool(const T_Bind&)>&), Const Override Method
+    template<class T_Bind> bool RepeatableOption<T_Bind>::checkBound(const std::function<bool(const T_Bind&)>& p_check)const{
+        if(m_bind){
+            for(const T_Bind& value: *m_bind){ // Every collected value
+                if(!p_check(value)) return false;
+            }
+        }
+        return true;
+    } // #END: checkBound(const std::function<bool(const T_Bind&)>&)
+
+    // #FUNCTION: bind(const std::string_view), Override Method
+    template<class T_Bind> std::expected<void, Error> RepeatableOption<T_Bind>::bind(const std::string_view p_bind){
         if(m_bind && m_converter){
-            if(auto result = m_converter(p_bind); result){
+            if(auto result = convertValue<T_Bind>(p_bind, m_converter); result){
                 m_bind->push_back(result.value());
                 return {}; // Success return void
             }else{
                 return std::unexpected<Error>(result.error());
             }
         }else{
-            return std::unexpected<Error>({Error::Type::NULL_BIND_OR_CONVERTER, p_bind});
+            return std::unexpected<Error>({Error::Type::NULL_BIND_OR_CONVERTER, std::string(p_bind)});
         }
-    } // #END: bind(const std::string&)
+    } // #END: bind(const std::string_view)
 
 // #END: RepeatableOption<T_Bind>
 
@@ -161,19 +372,29 @@ namespace simpleCli{ // #SCOPE: simpleCli
         return Type::CONTINUOUS_OPTION;
     } // #END: type()
 
-    // #FUNCTION: bind(const std::string&), Override Method
-    template<class T_Bind> std::expected<void, Error> ContinuousOption<T_Bind>::bind(const std::string& p_bind){
+    // #FUNCTION: checkBound(const std::function<bool(const T_Bind&)>&), Const Override Method
+    template<class T_Bind> bool ContinuousOption<T_Bind>::checkBound(const std::function<bool(const T_Bind&)>& p_check)const{
+        if(m_bind){
+            for(const T_Bind& value: *m_bind){ // Every collected value
+                if(!p_check(value)) return false;
+            }
+        }
+        return true;
+    } // #END: checkBound(const std::function<bool(const T_Bind&)>&)
+
+    // #FUNCTION: bind(const std::string_view), Override Method
+    template<class T_Bind> std::expected<void, Error> ContinuousOption<T_Bind>::bind(const std::string_view p_bind){
         if(m_bind && m_converter){
-            if(auto result = m_converter(p_bind)){
+            if(auto result = convertValue<T_Bind>(p_bind, m_converter)){
                 m_bind->push_back(result.value());
                 return {}; // Success return void
             }else{
                 return std::unexpected<Error>(result.error());
             }
         }else{
-            return std::unexpected<Error>({Error::Type::NULL_BIND_OR_CONVERTER, p_bind});
+            return std::unexpected<Error>({Error::Type::NULL_BIND_OR_CONVERTER, std::string(p_bind)});
         }
-    } // #END: bind(const std::string&)
+    } // #END: bind(const std::string_view)
 
 // #END: ContinuousOption<T_Bind>
 
@@ -230,22 +451,230 @@ namespace simpleCli{ // #SCOPE: simpleCli
         return Type::POSITIONAL;
     } // #END: type()
 
-    // #FUNCTION: bind(const std::string&), Override Method
-    template<class T_Bind> std::expected<void, Error> Positional<T_Bind>::bind(const std::string& p_bind){
+    // #FUNCTION: bind(const std::string_view), Override Method
+    template<class T_Bind> std::expected<void, Error> Positional<T_Bind>::bind(const std::string_view p_bind){
         if(m_bind && m_converter){
-            if(auto result = m_converter(p_bind); result){
+            if(auto result = convertValue<T_Bind>(p_bind, m_converter); result){
                 m_bind->push_back(result.value());
                 return {}; // Success return void
             }else{
                 return std::unexpected<Error>(result.error());
             }
         }else{
-            return std::unexpected<Error>({Error::Type::NULL_BIND_OR_CONVERTER, p_bind});
+            return std::unexpected<Error>({Error::Type::NULL_BIND_OR_CONVERTER, std::string(p_bind)});
         }
-    } // #END: bind(const std::string&)
+    } // #END: bind(const std::string_view)
 
 // #END: Positional<T_Bind>
 
+// #SCOPE: PositionalStream<T_Bind>
+
+// #DIV: Public Methods
+
+    // #FUNCTION: begin(), Method
+    template<class T_Bind> typename PositionalStream<T_Bind>::Iterator PositionalStream<T_Bind>::begin(){
+        if(!m_started){ // Pull first item on first iteration
+            m_started = true;
+            next();
+        }
+        return Iterator(this);
+    } // #END: begin()
+
+    // #FUNCTION: end(), Const Method
+    template<class T_Bind> std::default_sentinel_t PositionalStream<T_Bind>::end()const{
+        return std::default_sentinel;
+    } // #END: end()
+
+    // #FUNCTION: addArgument(const std::string_view), Method
+    template<class T_Bind> void PositionalStream<T_Bind>::addArgument(const std::string_view p_argument){
+        m_sources.push_back({Source::Type::ARGUMENT, p_argument}); // Not copied, must outlive iteration like argv does
+    } // #END: addArgument(const std::string_view)
+
+    // #FUNCTION: addFile(const std::string&), Method
+    template<class T_Bind> void PositionalStream<T_Bind>::addFile(const std::string& p_path){
+        m_sources.push_back({Source::Type::FILE, m_paths.emplace_back(p_path)});
+    } // #END: addFile(const std::string&)
+
+    // #FUNCTION: addStandardInput(), Method
+    template<class T_Bind> void PositionalStream<T_Bind>::addStandardInput(){
+        m_sources.push_back({Source::Type::STANDARD_INPUT, Argument::STANDARD_INPUT});
+    } // #END: addStandardInput()
+
+// #DIV: Private Methods
+
+    // #FUNCTION: next(), Method
+    template<class T_Bind> void PositionalStream<T_Bind>::next(){
+        while(true){
+            if(m_input){ // Reading one item per line
+                if(std::getline(*m_input, m_line)){
+                    if(!m_line.empty() && m_line.back() == '\r'){ // Windows line ending
+                        m_line.pop_back();
+                    }
+                    if(m_line.empty()){ // Skip blank line
+                        continue;
+                    }
+                    break;
+                }
+                closeInput(); // Source exhausted
+                continue;
+            }
+            if(m_position == m_sources.size()){ // All sources exhausted
+                m_current.reset();
+                return;
+            }
+            const Source& source = m_sources[m_position++];
+            if(source.type == Source::Type::ARGUMENT){
+                m_line = source.value;
+                break;
+            }else if(source.type == Source::Type::FILE){
+                m_file.open(source.value.data()); // Views a whole std::string in m_paths, so null terminated
+                if(!m_file.is_open()){ // Report and move on to next source
+                    m_file.clear();
+                    m_current = std::unexpected<Error>({Error::Type::FILE_OPEN_FAILURE, std::string(source.value)});
+                    return;
+                }
+                m_input = &m_file;
+            }else{
+                m_input = &std::cin;
+            }
+        }
+        if(m_converter){
+            m_current = m_converter(m_line);
+        }else{
+            m_current = std::unexpected<Error>({Error::Type::NULL_BIND_OR_CONVERTER, m_line});
+        }
+    } // #END: next()
+
+    // #FUNCTION: closeInput(), Method
+    template<class T_Bind> void PositionalStream<T_Bind>::closeInput(){
+        if(m_input == &m_file){
+            m_file.close();
+        }
+        m_input = nullptr;
+    } // #END: closeInput()
+
+    // #FUNCTION: reset(), Method
+    template<class T_Bind> void PositionalStream<T_Bind>::reset(){
+        closeInput();
+        m_sources.clear();
+        m_paths.clear();
+        m_position = 0;
+        m_current.reset();
+        m_started = false;
+    } // #END: reset()
+
+// #END: PositionalStream<T_Bind>
+
+// #SCOPE: PositionalStream<T_Bind>::Iterator
+
+// #DIV: Public Factory Methods
+
+    // #FUNCTION: Iterator(PositionalStream<T_Bind>* const), Template Constructor
+    template<class T_Bind> PositionalStream<T_Bind>::Iterator::Iterator(PositionalStream<T_Bind>* const p_stream){
+        m_stream = p_stream;
+    } // #END: Iterator(PositionalStream<T_Bind>* const)
+
+// #DIV: Public Methods
+
+    // #FUNCTION: operator*(), Const Method
+    template<class T_Bind> auto PositionalStream<T_Bind>::Iterator::operator*()const->const value_type&{
+        return *m_stream->m_current;
+    } // #END: operator*()
+
+    // #FUNCTION: operator++(), Method
+    template<class T_Bind> auto PositionalStream<T_Bind>::Iterator::operator++()->Iterator&{
+        m_stream->next(); // Pull next item only when asked
+        return *this;
+    } // #END: operator++()
+
+    // #FUNCTION: operator++(int), Method
+    template<class T_Bind> void PositionalStream<T_Bind>::Iterator::operator++(int){
+        ++*this;
+    } // #END: operator++(int)
+
+    // #FUNCTION: operator==(std::default_sentinel_t), Const Method
+    template<class T_Bind> bool PositionalStream<T_Bind>::Iterator::operator==(std::default_sentinel_t)const{
+        return !m_stream || !m_stream->m_current;
+    } // #END: operator==(std::default_sentinel_t)
+
+// #END: PositionalStream<T_Bind>::Iterator
+
+// #SCOPE: StreamedPositional<T_Bind>
+
+// #DIV: Public Factory Methods
+
+    // #FUNCTION: StreamedPositional(PositionalStream<T_Bind>* const, const Converter<T_Bind>&), Template Constructor
+    template<class T_Bind> StreamedPositional<T_Bind>::StreamedPositional(PositionalStream<T_Bind>* const p_bind, const Converter<T_Bind>& p_converter){
+        m_bind = p_bind;
+        m_bind->m_converter = p_converter; // Items are converted as the stream is pulled
+    } // #END: StreamedPositional(PositionalStream<T_Bind>* const, const Converter<T_Bind>&)
+
+    // #FUNCTION: StreamedPositional(PositionalStream<T_Bind>* const, Converter<T_Bind>&&), Template Constructor
+    template<class T_Bind> StreamedPositional<T_Bind>::StreamedPositional(PositionalStream<T_Bind>* const p_bind, Converter<T_Bind>&& p_converter){
+        m_bind = p_bind;
+        m_bind->m_converter = std::move(p_converter); // Items are converted as the stream is pulled
+    } // #END: StreamedPositional(PositionalStream<T_Bind>* const, Converter<T_Bind>&&)
+
+// #DIV: Public Methods
+
+    // #FUNCTION: type(), Const Override Method
+    template<class T_Bind> Argument::Type StreamedPositional<T_Bind>::type()const{
+        return Type::STREAMED_POSITIONAL;
+    } // #END: type()
+
+    // #FUNCTION: bind(const std::string_view), Override Method
+    template<class T_Bind> std::expected<void, Error> StreamedPositional<T_Bind>::bind(const std::string_view p_bind){
+        if(!m_bind){
+            return std::unexpected<Error>({Error::Type::NULL_BIND_OR_CONVERTER, std::string(p_bind)});
+        }
+        if(p_bind == STANDARD_INPUT){
+            m_bind->addStandardInput();
+        }else{
+            m_bind->addArgument(p_bind); // Views argv, no copy per path
+        }
+        return {}; // Success return void
+    } // #END: bind(const std::string_view)
+
+    // #FUNCTION: reset(), Override Method
+    template<class T_Bind> void StreamedPositional<T_Bind>::reset(){
+        if(m_bind){
+            m_bind->reset(); // Sources of a previous parse are dropped
+        }
+    } // #END: reset()
+
+// #END: StreamedPositional<T_Bind>
+
+// #SCOPE: PositionalSource<T_Bind>
+
+// #DIV: Public Factory Methods
+
+    // #FUNCTION: PositionalSource(PositionalStream<T_Bind>* const), Template Constructor
+    template<class T_Bind> PositionalSource<T_Bind>::PositionalSource(PositionalStream<T_Bind>* const p_bind){
+        m_bind = p_bind;
+    } // #END: PositionalSource(PositionalStream<T_Bind>* const)
+
+// #DIV: Public Methods
+
+    // #FUNCTION: type(), Const Override Method
+    template<class T_Bind> Argument::Type PositionalSource<T_Bind>::type()const{
+        return Type::POSITIONAL_SOURCE;
+    } // #END: type()
+
+    // #FUNCTION: bind(const std::string_view), Override Method
+    template<class T_Bind> std::expected<void, Error> PositionalSource<T_Bind>::bind(const std::string_view p_bind){
+        if(!m_bind){
+            return std::unexpected<Error>({Error::Type::NULL_BIND_OR_CONVERTER, std::string(p_bind)});
+        }
+        if(p_bind == STANDARD_INPUT){
+            m_bind->addStandardInput();
+        }else{
+            m_bind->addFile(std::string(p_bind));
+        }
+        return {}; // Success return void
+    } // #END: bind(const std::string_view)
+
+// #END: PositionalSource<T_Bind>
+
 // #SCOPE: Program<T_Bind>
 
 // #DIV: Public Factory Methods
@@ -269,21 +698,135 @@ namespace simpleCli{ // #SCOPE: simpleCli
         return Type::PROGRAM;
     } // #END: type()
 
-    // #FUNCTION: bind(const std::string&), Override Method
-    template<class T_Bind> std::expected<void, Error> Program<T_Bind>::bind(const std::string& p_bind){
+    // #FUNCTION: bind(const std::string_view), Override Method
+    template<class T_Bind> std::expected<void, Error> Program<T_Bind>::bind(const std::string_view p_bind){
         if(m_bind && m_converter){
-            if(auto result = m_converter(p_bind); result){
+            if(auto result = convertValue<T_Bind>(p_bind, m_converter); result){
                 *m_bind = result.value();
                 return {}; // Success return void
             }else{
                 return std::unexpected<Error>(result.error());
             }
         }else{
-            return std::unexpected<Error>({Error::Type::NULL_BIND_OR_CONVERTER, p_bind});
+            return std::unexpected<Error>({Error::Type::NULL_BIND_OR_CONVERTER, std::string(p_bind)});
         }
-    } // #END: bind(const std::string&)
+    } // #END: bind(const std::string_view)
 
 // #END: Program<T_Bind>
 
+// #SCOPE: FieldFlag<T_Config>
+
+// #DIV: Public Factory Methods
+
+    // #FUNCTION: FieldFlag(T_Config* const* const, bool T_Config::* const), Template Constructor
+    template<class T_Config> FieldFlag<T_Config>::FieldFlag(T_Config* const* const p_target, bool T_Config::* const p_member){
+        m_target = p_target;
+        m_member = p_member;
+    } // #END: FieldFlag(T_Config* const* const, bool T_Config::* const)
+
+// #DIV: Public Methods
+
+    // #FUNCTION: type(), Const Override Method
+    template<class T_Config> Argument::Type FieldFlag<T_Config>::type()const{
+        return Type::FLAG;
+    } // #END: type()
+
+    // #FUNCTION: flag(), Override Method
+    template<class T_Config> void FieldFlag<T_Config>::flag(){
+        if(m_target && *m_target){
+            (*m_target)->*m_member = true;
+        }
+    } // #END: flag()
+
+    // #FUNCTION: callback(), Override Method
+    template<class T_Config> void FieldFlag<T_Config>::callback(){
+
+    } // #END: callback()
+
+// #END: FieldFlag<T_Config>
+
+// #SCOPE: FieldOption<T_Config, T_Bind>
+
+// #DIV: Public Factory Methods
+
+    // #FUNCTION: FieldOption(T_Config* const* const, T_Bind T_Config::* const, const Converter<T_Bind>&), Template Constructor
+    template<class T_Config, class T_Bind> FieldOption<T_Config, T_Bind>::FieldOption(T_Config* const* const p_target, T_Bind T_Config::* const p_member, const Converter<T_Bind>& p_converter){
+        m_target = p_target;
+        m_member = p_member;
+        m_converter = p_converter;
+    } // #END: FieldOption(T_Config* const* const, T_Bind T_Config::* const, const Converter<T_Bind>&)
+
+// #DIV: Public Methods
+
+    // #FUNCTION: type(), Const Override Method
+    template<class T_Config, class T_Bind> Argument::Type FieldOption<T_Config, T_Bind>::type()const{
+        return Type::OPTION;
+    } // #END: type()
+
+    // #FUNCTION: bind(const std::string_view), Override Method
+    template<class T_Config, class T_Bind> std::expected<void, Error> FieldOption<T_Config, T_Bind>::bind(const std::string_view p_bind){
+        if(m_target && *m_target && m_converter){
+            if(auto result = convertValue<T_Bind>(p_bind, m_converter); result){
+                (*m_target)->*m_member = std::move(result.value());
+                return {}; // Success return void
+            }else{
+                return std::unexpected<Error>(result.error());
+            }
+        }else{
+            return std::unexpected<Error>({Error::Type::NULL_BIND_OR_CONVERTER, std::string(p_bind)});
+        }
+    } // #END: bind(const std::string_view)
+
+    // #FUNCTION: checkBound(const std::function<bool(const T_Bind&)>&), Const Override Method
+    template<class T_Config, class T_Bind> bool FieldOption<T_Config, T_Bind>::checkBound(const std::function<bool(const T_Bind&)>& p_check)const{
+        return !m_target || !*m_target || p_check((*m_target)->*m_member); // Field of the config being parsed
+    } // #END: checkBound(const std::function<bool(const T_Bind&)>&)
+
+// #END: FieldOption<T_Config, T_Bind>
+
+// #SCOPE: FieldRepeatableOption<T_Config, T_Bind>
+
+// #DIV: Public Factory Methods
+
+    // #FUNCTION: FieldRepeatableOption(T_Config* const* const, std::vector<T_Bind> T_Config::* const, const Converter<T_Bind>&), Template Constructor
+    template<class T_Config, class T_Bind> FieldRepeatableOption<T_Config, T_Bind>::FieldRepeatableOption(T_Config* const* const p_target, std::vector<T_Bind> T_Config::* const p_member, const Converter<T_Bind>& p_converter){
+        m_target = p_target;
+        m_member = p_member;
+        m_converter = p_converter;
+    } // #END: FieldRepeatableOption(T_Config* const* const, std::vector<T_Bind> T_Config::* const, const Converter<T_Bind>&)
+
+// #DIV: Public Methods
+
+    // #FUNCTION: type(), Const Override Method
+    template<class T_Config, class T_Bind> Argument::Type FieldRepeatableOption<T_Config, T_Bind>::type()const{
+        return Type::REPEATABLE_OPTION;
+    } // #END: type()
+
+    // #FUNCTION: bind(const std::string_view), Override Method
+    template<class T_Config, class T_Bind> std::expected<void, Error> FieldRepeatableOption<T_Config, T_Bind>::bind(const std::string_view p_bind){
+        if(m_target && *m_target && m_converter){
+            if(auto result = convertValue<T_Bind>(p_bind, m_converter); result){
+                ((*m_target)->*m_member).push_back(std::move(result.value()));
+                return {}; // Success return void
+            }else{
+                return std::unexpected<Error>(result.error());
+            }
+        }else{
+            return std::unexpected<Error>({Error::Type::NULL_BIND_OR_CONVERTER, std::string(p_bind)});
+        }
+    } // #END: bind(const std::string_view)
+
+    // #FUNCTION: checkBound(const std::function<bool(const T_Bind&)>&), Const Override Method
+    template<class T_Config, class T_Bind> bool FieldRepeatableOption<T_Config, T_Bind>::checkBound(const std::function<bool(const T_Bind&)>& p_check)const{
+        if(m_target && *m_target){
+            for(const T_Bind& value: (*m_target)->*m_member){ // Every collected value
+                if(!p_check(value)) return false;
+            }
+        }
+        return true;
+    } // #END: checkBound(const std::function<bool(const T_Bind&)>&)
+
+// #END: FieldRepeatableOption<T_Config, T_Bind>
+
 } // #END: simpleCli
 
@@ -21,6 +21,11 @@ namespace simpleCli{ // #SCOPE: simpleCli
 
     } // #END: Error(const Type, const std::string&)
 
+    // #FUNCTION: Error(const Type, const std::string&, const std::size_t), Public Constructor
+    Error::Error(const Type p_type, const std::string& p_body, const std::size_t p_offset): type(p_type), body(p_body), offset(p_offset){
+
+    } // #END: Error(const Type, const std::string&, const std::size_t)
+
     // #FUNCTION: Error(const Type), Public Constructor
     Error::Error(const Type p_type): type(p_type){
 
@@ -29,7 +34,7 @@ namespace simpleCli{ // #SCOPE: simpleCli
 // DIV: Public Methods
 
     // #FUNCTION: message(), Public Method
-    std::string Error::message(){
+    std::string Error::message()const{
         switch(type){
             case Type::REPEATED_TAG: {
                 return "Repeated Tag: " + body;
@@ -69,6 +74,28 @@ namespace simpleCli{ // #SCOPE: simpleCli
                 return "Positional Argument \"" + body + "\" Passed But No Positional Support Configured";
             }case Type::INVALID_INLINE_ASSIGNMENT: {
                 return "Option Given A Tag As Value On Inline Assignment: " + body;
+            }case Type::INVALID_KEY_VALUE_PAIR: {
+                return "Missing Key Value Separator At Offset " + std::to_string(offset) + " Of \"" + body + "\"";
+            }case Type::FILE_OPEN_FAILURE: {
+                return "Failure To Open Positional Source File: " + body;
+            }case Type::UNTERMINATED_QUOTE: {
+                return "Unterminated " + body + " Quote Starting At Offset " + std::to_string(offset);
+            }case Type::DANGLING_ESCAPE: {
+                return "Dangling Escape At Offset " + std::to_string(offset);
+            }case Type::MISSING_REQUIRED_ARGUMENT: {
+                return "Missing Required Argument: " + body;
+            }case Type::CONFLICTING_ARGUMENTS: {
+                return "Conflicting Arguments: " + body;
+            }case Type::MISSING_DEPENDENCY: {
+                return "Missing Dependency: " + body;
+            }case Type::VALUE_OUT_OF_RANGE: {
+                return "Value Out Of Range For: " + body;
+            }case Type::VALUE_NOT_ALLOWED: {
+                return "Value Not Allowed For: " + body;
+            }case Type::CAPACITY_EXCEEDED: {
+                return "Fixed Capacity Exceeded: " + body;
+            }case Type::TYPE_MISMATCH: {
+                return "Constraint Value Type Does Not Match The Bound Type Of: " + body;
             }default: {
                 return "Unknown Error";
             }
@@ -31,17 +31,30 @@ namespace simpleCli{ // #SCOPE: simpleCli
             INVALID_VALUE,
             ARGUMENT_DOES_NOT_TAKE_VALUE,
             POSITIONALS_NOT_SUPPORTED,
-            INVALID_INLINE_ASSIGNMENT
+            INVALID_INLINE_ASSIGNMENT,
+            INVALID_KEY_VALUE_PAIR,
+            FILE_OPEN_FAILURE,
+            UNTERMINATED_QUOTE,
+            DANGLING_ESCAPE,
+            MISSING_REQUIRED_ARGUMENT,
+            CONFLICTING_ARGUMENTS,
+            MISSING_DEPENDENCY,
+            VALUE_OUT_OF_RANGE,
+            VALUE_NOT_ALLOWED,
+            CAPACITY_EXCEEDED,
+            TYPE_MISMATCH
         };
     // Factory Methods
         Error() = default;
         Error(const Type p_type, const std::string& p_body);
+        Error(const Type p_type, const std::string& p_body, const std::size_t p_offset);
         Error(const Type p_type);
     // Static Methods
-        std::string message();
+        std::string message()const;
     // Members
         Type type;
         std::string body;
+        std::size_t offset = 0; // Offset into the parsed value, used by element and tokenizer errors
     }; // #END: Error
 
 } // #END: simpleCli
@@ -17,214 +17,324 @@
 
 namespace simpleCli{ // #SCOPE: simpleCli
 
+// #SCOPE: ParseResult
+
+// #DIV: Public Methods
+
+    // #FUNCTION: operator bool(), Const Method
+    ParseResult::operator bool()const{
+        return parsed;
+    } // #END: operator bool()
+
+// #END: ParseResult
+
 // #SCOPE: Parser
 
 // #DIV: Public Methods
 
     // #FUNCTION: parse(), Const Method
-    std::expected<bool, Error> Parser::parse(const int argc, char** const argv)const{
-        if(argc < 1 || argv == nullptr){ // Empty or invalid command line
-            return std::unexpected<Error>({Error::Type::INVALID_COMMAND_LINE});
-        }
-        if(argc == 1){ // No arguments provided
-            return false;
-        }
-        // Handle Program Name
-        if(m_program){
-            if(auto result = bind(m_program, std::string(argv[0])); !result){
-                return std::unexpected<Error>(result.error());
-            }
-        }
-        std::vector<std::string> commandLine = std::vector<std::string>(argv + 1, argv + argc);
-        if(auto result = preprocess(commandLine); !result){
+    std::expected<ParseResult, Error> Parser::parse(const int argc, char** const argv)const{
+        return parseArguments(argc, argv, false); // Empty argv entries are skipped
+    } // #END: parse()
+
+    // #FUNCTION: parse(const std::string_view), Method
+    std::expected<ParseResult, Error> Parser::parse(const std::string_view p_commandLine){
+        if(auto result = tokenize(p_commandLine); !result){
             return std::unexpected<Error>(result.error());
         }
-        bool previousTakesValue = false;
-        std::string previousTag = "";
-        for(const std::string& arg: commandLine){
-            if(auto argument = getArgument(arg)){ // Is a known tag
-                if(previousTakesValue && m_arguments.at(previousTag)->type() != Argument::Type::CONTINUOUS_OPTION){ // Previous was option that was not given a value
-                    return std::unexpected<Error>({Error::Type::NO_VALUE_PROVIDED, previousTag});
-                }
-                if(argument->type() == Argument::Type::FLAG){ // Is flag
-                    if(auto result = flag(argument); !result){
-                        return std::unexpected<Error>(result.error());
-                    }
-                }
-                previousTag = arg;
-                previousTakesValue = argument->takesValue();
-            }else if(previousTakesValue){ // Previous was option taking value
-                if(auto argument = getArgument(previousTag)){ // Previous is known tag
-                    if(auto result = bind(argument, arg); !result){
-                        return std::unexpected<Error>(result.error());
-                    }
-                    if(argument->type() != Argument::Type::CONTINUOUS_OPTION){
-                        previousTakesValue = false; 
-                    }
-                }
-            }else{ // Is positional
-                if(m_positionals){
-                    if(auto result = bind(m_positionals, arg); !result){
-                        return std::unexpected<Error>(result.error());
-                    }
-                }else{
-                    return std::unexpected<Error>({Error::Type::POSITIONALS_NOT_SUPPORTED, arg});
-                }
-            }
-        }
-        if(previousTakesValue && m_arguments.at(previousTag)->type() != Argument::Type::CONTINUOUS_OPTION){ // Previous was option that was not given a value
-            return std::unexpected<Error>({Error::Type::NO_VALUE_PROVIDED, previousTag});
-        }
-        return true; // Successfully parsed arguments
-    } // #END: parse()
+        // View binds point into m_tokenBuffer and stay valid until the next string parse
+        return parseArguments(static_cast<int>(m_tokenArguments.size()), m_tokenArguments.data(), true); // Quoted '' stays a value
+    } // #END: parse(const std::string_view)
 
     // #FUNCTION: addFlag(const std::initializer_list<std::string_view>, bool&), Method
     std::expected<void, Error> Parser::addFlag(const std::initializer_list<std::string_view> p_tags, bool& p_bind){
+        const std::expected<std::size_t, Error> index = reserveIndex(p_tags);
+        if(!index) return std::unexpected<Error>(index.error());
         for(const std::string_view& tagView: p_tags){
             std::string tag = std::string(tagView);
-            if(!isValidTag(tag)) return std::unexpected<Error>({Error::Type::INVALID_TAG, std::move(tag)});
-            if(!isUniqueTag(tag)) return std::unexpected<Error>({Error::Type::REPEATED_TAG, std::move(tag)});
-            m_arguments[std::move(tag)] = std::shared_ptr<Argument>(new Flag(&p_bind));
+            std::shared_ptr<Argument> argument = std::shared_ptr<Argument>(new Flag(&p_bind));
+            argument->setIndex(index.value());
+            m_arguments[std::move(tag)] = std::move(argument);
         }
         return {};
     } // #END: addFlag(const std::initializer_list<std::string_view>, bool&)
 
     // #FUNCTION: addFlag(const std::initializer_list<std::string_view>, const std::function<void()>&), Method
     std::expected<void, Error> Parser::addFlag(const std::initializer_list<std::string_view> p_tags, const std::function<void()>& p_callback){
+        const std::expected<std::size_t, Error> index = reserveIndex(p_tags);
+        if(!index) return std::unexpected<Error>(index.error());
         for(const std::string_view& tagView: p_tags){
             std::string tag = std::string(tagView);
-            if(!isValidTag(tag)) return std::unexpected<Error>({Error::Type::INVALID_TAG, std::move(tag)});
-            if(!isUniqueTag(tag)) return std::unexpected<Error>({Error::Type::REPEATED_TAG, std::move(tag)});
-            m_arguments[std::move(tag)] = std::shared_ptr<Argument>(new Flag(p_callback));
+            std::shared_ptr<Argument> argument = std::shared_ptr<Argument>(new Flag(p_callback));
+            argument->setIndex(index.value());
+            m_arguments[std::move(tag)] = std::move(argument);
         }
         return {};
     } // #END: addFlag(const std::initializer_list<std::string_view>, const std::function<void()>&)
 
     // #FUNCTION: addFlag(const std::initializer_list<std::string_view>, std::function<void()>&&), Method
     std::expected<void, Error> Parser::addFlag(const std::initializer_list<std::string_view> p_tags, std::function<void()>&& p_callback){
+        const std::expected<std::size_t, Error> index = reserveIndex(p_tags);
+        if(!index) return std::unexpected<Error>(index.error());
         for(const std::string_view& tagView: p_tags){
             std::string tag = std::string(tagView);
-            if(!isValidTag(tag)) return std::unexpected<Error>({Error::Type::INVALID_TAG, std::move(tag)});
-            if(!isUniqueTag(tag)) return std::unexpected<Error>({Error::Type::REPEATED_TAG, std::move(tag)});
-            m_arguments[std::move(tag)] = std::shared_ptr<Argument>(new Flag(std::move(p_callback)));
+            std::shared_ptr<Argument> argument = std::shared_ptr<Argument>(new Flag(std::move(p_callback)));
+            argument->setIndex(index.value());
+            m_arguments[std::move(tag)] = std::move(argument);
         }
         return {};
     } // #END: addFlag(const std::initializer_list<std::string_view>, std::function<void()>&&)
 
     // #FUNCTION: addFlag(const std::initializer_list<std::string_view>, bool&, const std::function<void()>&), Method
     std::expected<void, Error> Parser::addFlag(const std::initializer_list<std::string_view> p_tags, bool& p_bind, const std::function<void()>& p_callback){
+        const std::expected<std::size_t, Error> index = reserveIndex(p_tags);
+        if(!index) return std::unexpected<Error>(index.error());
         for(const std::string_view& tagView: p_tags){
             std::string tag = std::string(tagView);
-            if(!isValidTag(tag)) return std::unexpected<Error>({Error::Type::INVALID_TAG, std::move(tag)});
-            if(!isUniqueTag(tag)) return std::unexpected<Error>({Error::Type::REPEATED_TAG, std::move(tag)});
-            m_arguments[std::move(tag)] = std::shared_ptr<Argument>(new Flag(&p_bind, p_callback));
+            std::shared_ptr<Argument> argument = std::shared_ptr<Argument>(new Flag(&p_bind, p_callback));
+            argument->setIndex(index.value());
+            m_arguments[std::move(tag)] = std::move(argument);
         }
         return {};
     } // #END: addFlag(const std::initializer_list<std::string_view>, bool&, const std::function<void()>&)
 
     // #FUNCTION: addFlag(const std::initializer_list<std::string_view>, bool&, std::function<void()>&&), Method
     std::expected<void, Error> Parser::addFlag(std::initializer_list<std::string_view> p_tags, bool& p_bind, std::function<void()>&& p_callback){
+        const std::expected<std::size_t, Error> index = reserveIndex(p_tags);
+        if(!index) return std::unexpected<Error>(index.error());
         for(const std::string_view& tagView: p_tags){
             std::string tag = std::string(tagView);
-            if(!isValidTag(tag)) return std::unexpected<Error>({Error::Type::INVALID_TAG, std::move(tag)});
-            if(!isUniqueTag(tag)) return std::unexpected<Error>({Error::Type::REPEATED_TAG, std::move(tag)});
-            m_arguments[std::move(tag)] = std::shared_ptr<Argument>(new Flag(&p_bind, std::move(p_callback)));
+            std::shared_ptr<Argument> argument = std::shared_ptr<Argument>(new Flag(&p_bind, std::move(p_callback)));
+            argument->setIndex(index.value());
+            m_arguments[std::move(tag)] = std::move(argument);
         }
         return {};
     } // #END: addFlag(const std::initializer_list<std::string_view>, bool&, std::function<void()>&&)
 
-// #DIV: Private Methods
+    // #FUNCTION: setStopFlag(const std::initializer_list<std::string_view>), Method
+    std::expected<void, Error> Parser::setStopFlag(const std::initializer_list<std::string_view> p_tags){
+        for(const std::string_view& tagView: p_tags){
+            auto argument = getArgument(tagView);
+            if(!argument) return std::unexpected<Error>({Error::Type::INVALID_TAG, std::string(tagView)});
+            if(argument->type() != Argument::Type::FLAG) return std::unexpected<Error>({Error::Type::NOT_FLAGGABLE, std::string(tagView)});
+            setBit(m_stops, argument->index()); // Every alias registered with this tag stops too
+        }
+        return {};
+    } // #END: setStopFlag(const std::initializer_list<std::string_view>)
 
-    // #FUNCTION: isUniqueTag(const std::string_view&), Method
-    bool Parser::isUniqueTag(const std::string& p_tag)const{
-        return !m_arguments.contains(p_tag);
-    } // #END: Private Methods
-    
-    // #FUNCTION: isValidTag(const std::string_view&), Method
-    bool Parser::isValidTag(const std::string& p_tag)const{
-        if(p_tag.size() >= LONG_TAG_MIN_SIZE){ // Long Tag
-            return p_tag[0] == '-' && p_tag[1] == '-';
-        }else if(p_tag.size() == SHORT_TAG_SIZE){ // Short Tag
-            return p_tag[0] == '-';
-        }else{
-            return false;
+    // #FUNCTION: addRequired(const std::initializer_list<std::string_view>), Method
+    std::expected<void, Error> Parser::addRequired(const std::initializer_list<std::string_view> p_tags){
+        for(const std::string_view& tagView: p_tags){
+            auto index = getIndex(tagView);
+            if(!index) return std::unexpected<Error>(index.error());
+            setBit(m_required, index.value());
         }
-    } // #END: Private Methods
+        m_constrained = true;
+        return {};
+    } // #END: addRequired(const std::initializer_list<std::string_view>)
 
-    // #FUNCTION: isValidValue(const std::string&), Method
-    bool Parser::isValidValue(const std::string& p_value)const{
-        if(p_value.size() == 1 && p_value[0] == '-'){ // Single dash is not valid value
-            return false;
+    // #FUNCTION: addConflict(const std::initializer_list<std::string_view>), Method
+    std::expected<void, Error> Parser::addConflict(const std::initializer_list<std::string_view> p_tags){
+        std::vector<std::size_t> indices;
+        for(const std::string_view& tagView: p_tags){
+            auto index = getIndex(tagView);
+            if(!index) return std::unexpected<Error>(index.error());
+            indices.push_back(index.value());
         }
-        if(p_value.size() == 2 && p_value[0] == '-'){ // Looks like a short tag
-            try{
-                std::stoi(p_value);
-                return true; // Is a negative single digit number
-            }catch(...){
-                return false; // Not a valid short tag
+        for(const std::size_t index: indices){ // Fold the group into each member's conflict mask
+            for(const std::size_t other: indices){
+                if(other != index){
+                    setBit(getRules(index).conflicts, other);
+                }
             }
         }
-        if(p_value[0] == '-' && p_value[1] == '-') return false; // Invalid long tag
-        return true;
-    } // #END: isValidValue(const std::string&)
-
-    // #FUNCTION: preprocess(std::vector<std::string>&), Const Method
-    std::expected<void, Error> Parser::preprocess(std::vector<std::string>& p_commandLine)const{
-        for(std::size_t position = 0; position < p_commandLine.size(); position++){
-            // Remove empty argument
-            if(p_commandLine[position].empty()){ // Is empty arg
-                p_commandLine.erase(p_commandLine.begin() + position); // Erase arg
-                position--; // Adjust position after erase
+        m_constrained = true;
+        return {};
+    } // #END: addConflict(const std::initializer_list<std::string_view>)
+
+    // #FUNCTION: addDependency(const std::string_view, const std::initializer_list<std::string_view>), Method
+    std::expected<void, Error> Parser::addDependency(const std::string_view p_tag, const std::initializer_list<std::string_view> p_dependencies){
+        auto index = getIndex(p_tag);
+        if(!index) return std::unexpected<Error>(index.error());
+        for(const std::string_view& tagView: p_dependencies){
+            auto dependency = getIndex(tagView);
+            if(!dependency) return std::unexpected<Error>(dependency.error());
+            setBit(getRules(index.value()).dependencies, dependency.value());
+        }
+        m_constrained = true;
+        return {};
+    } // #END: addDependency(const std::string_view, const std::initializer_list<std::string_view>)
+
+// #DIV: Private Methods
+
+    // #FUNCTION: parseArguments(const int, char** const, const bool), Const Method
+    std::expected<ParseResult, Error> Parser::parseArguments(const int argc, char** const argv, const bool p_keepEmpty)const{
+        if(argc < 1 || argv == nullptr){ // Empty or invalid command line
+            return std::unexpected<Error>({Error::Type::INVALID_COMMAND_LINE});
+        }
+        if(m_positionals){
+            m_positionals->reset(); // Drop per-parse state such as streamed sources
+        }
+        ParseResult parseResult;
+        if(argc == 1){ // No arguments provided
+            if(m_constrained){
+                if(auto result = checkConstraints(Mask()); !result){
+                    return std::unexpected<Error>(result.error());
+                }
+            }
+            return parseResult;
+        }
+        parseResult.parsed = true;
+        // Find where parsing stops, the tail is never preprocessed or looked up
+        int last = argc;
+        bool stopFlag = false;
+        for(int position = 1; position < argc; position++){
+            const std::string_view arg = argv[position];
+            if(arg == END_OF_OPTIONS){ // Terminator is dropped
+                last = position;
+            }else if(isStopFlag(arg)){ // Stop flag is still parsed
+                last = position + 1;
+                stopFlag = true;
+            }else{
                 continue;
             }
-            // Separate inline value
-            if(auto it = p_commandLine[position].find(OPTION_VALUE_SEPARATOR); it != std::string::npos){ // Has inline value
-                std::string newTag = p_commandLine[position].substr(0, it); // Extract tag
-                std::string newValue = p_commandLine[position].substr(it + 1); // Extract value
-                if(auto argument = getArgument(newTag)){ // Known tag with inline assignment
-                    if(!argument->takesValue()){ // Tag does not take value
-                        return std::unexpected<Error>({Error::Type::ARGUMENT_DOES_NOT_TAKE_VALUE, p_commandLine[position]});
+            parseResult.stopped = true;
+            parseResult.remainder = std::span<char*>(argv + position + 1, argv + argc);
+            break;
+        }
+        // Handle Program Name
+        if(m_program){
+            if(auto result = bind(m_program, std::string_view(argv[0])); !result){
+                return std::unexpected<Error>(result.error());
+            }
+        }
+        std::vector<std::string_view> commandLine;
+        commandLine.reserve(2 * static_cast<std::size_t>(last - 1)); // Room for every inline assignment to split in two
+        if(auto result = preprocess(std::span<char* const>(argv + 1, argv + last), p_keepEmpty, commandLine); !result){ // Views into argv, values are never copied
+            return std::unexpected<Error>(result.error());
+        }
+        Mask seen; // Arguments given, by constraint bit
+        if(m_constrained){
+            seen.resize((m_names.size() + 63) / 64);
+        }
+        bool previousTakesValue = false;
+        std::string_view previousTag;
+        for(const std::string_view arg: commandLine){
+            if(auto argument = getArgument(arg)){ // Is a known tag
+                if(m_constrained){
+                    setBit(seen, argument->index());
+                }
+                if(previousTakesValue && getArgument(previousTag)->type() != Argument::Type::CONTINUOUS_OPTION){ // Previous was option that was not given a value
+                    return std::unexpected<Error>({Error::Type::NO_VALUE_PROVIDED, std::string(previousTag)});
+                }
+                if(argument->type() == Argument::Type::FLAG){ // Is flag
+                    if(auto result = flag(argument); !result){
+                        return std::unexpected<Error>(result.error());
                     }
-                    p_commandLine[position] = newTag; // Update tag
-                }else{ // Unknown tag with inline assignment
-                    if(newTag.empty()){ // Dangling '=' at start
-                        return std::unexpected<Error>({Error::Type::EMPTY_OPTION_TAG, p_commandLine[position]});
-                    }else{
-                        continue; 
+                }
+                previousTag = arg;
+                previousTakesValue = argument->takesValue();
+            }else if(previousTakesValue){ // Previous was option taking value
+                if(auto argument = getArgument(previousTag)){ // Previous is known tag
+                    if(auto result = bind(argument, arg); !result){
+                        return std::unexpected<Error>(result.error());
+                    }
+                    if(argument->type() != Argument::Type::CONTINUOUS_OPTION){
+                        previousTakesValue = false; 
+                    }
+                }
+            }else{ // Is positional
+                if(m_positionals){
+                    if(auto result = bind(m_positionals, arg); !result){
+                        return std::unexpected<Error>(result.error());
                     }
+                }else{
+                    return std::unexpected<Error>({Error::Type::POSITIONALS_NOT_SUPPORTED, std::string(arg)});
                 }
-                if(m_arguments.contains(newValue)){ // Value is a tag
-                    return std::unexpected<Error>({Error::Type::INVALID_INLINE_ASSIGNMENT, newTag + OPTION_VALUE_SEPARATOR + newValue});
+            }
+        }
+        if(previousTakesValue && getArgument(previousTag)->type() != Argument::Type::CONTINUOUS_OPTION){ // Previous was option that was not given a value
+            return std::unexpected<Error>({Error::Type::NO_VALUE_PROVIDED, std::string(previousTag)});
+        }
+        if(m_constrained && !stopFlag){ // Stop flags such as --help skip constraints
+            if(auto result = checkConstraints(seen); !result){
+                return std::unexpected<Error>(result.error());
+            }
+        }
+        return parseResult; // Successfully parsed arguments
+    } // #END: parseArguments(const int, char** const, const bool)
+
+    // #FUNCTION: isUniqueTag(const std::string_view&), Method
+    bool Parser::isUniqueTag(const std::string_view p_tag)const{
+        return !m_arguments.contains(p_tag);
+    } // #END: Private Methods
+    
+    // #FUNCTION: isStandardInput(const Argument&, const std::string_view), Const Method
+    bool Parser::isStandardInput(const Argument& p_bindable, const std::string_view p_value)const{
+        const Argument::Type type = p_bindable.type();
+        return (type == Argument::Type::STREAMED_POSITIONAL || type == Argument::Type::POSITIONAL_SOURCE) && p_value == Argument::STANDARD_INPUT;
+    } // #END: isStandardInput(const Argument&, const std::string_view)
+
+    // #FUNCTION: preprocess(const std::span<char* const>, const bool, std::vector<std::string_view>&), Const Method
+    std::expected<void, Error> Parser::preprocess(const std::span<char* const> p_arguments, const bool p_keepEmpty, std::vector<std::string_view>& p_commandLine)const{
+        for(const std::string_view arg: p_arguments){ // One forward pass, tokens are only ever appended
+            // Drop empty argument unless it was quoted on purpose
+            if(arg.empty()){
+                if(p_keepEmpty){
+                    p_commandLine.push_back(arg);
+                }
+                continue;
+            }
+            // Separate inline value
+            const std::size_t it = arg.find(OPTION_VALUE_SEPARATOR);
+            if(it == std::string_view::npos){ // No inline value
+                p_commandLine.push_back(arg);
+                continue;
+            }
+            std::string_view newTag = arg.substr(0, it); // Extract tag
+            std::string_view newValue = arg.substr(it + 1); // Extract value, a suffix of the argv entry
+            if(auto argument = getArgument(newTag)){ // Known tag with inline assignment
+                if(!argument->takesValue()){ // Tag does not take value
+                    return std::unexpected<Error>({Error::Type::ARGUMENT_DOES_NOT_TAKE_VALUE, std::string(arg)});
                 }
-                if(!newValue.empty()){ // Has value
-                    p_commandLine.insert(p_commandLine.begin() + position + 1, std::move(newValue)); // Insert value after tag
-                }else{ // No value
-                    return std::unexpected<Error>({Error::Type::EMPTY_OPTION_VALUE, p_commandLine[position] + OPTION_VALUE_SEPARATOR});
+            }else{ // Unknown tag with inline assignment
+                if(newTag.empty()){ // Dangling '=' at start
+                    return std::unexpected<Error>({Error::Type::EMPTY_OPTION_TAG, std::string(arg)});
                 }
+                p_commandLine.push_back(arg); // Kept whole, likely a value such as key=value
+                continue;
+            }
+            if(m_arguments.contains(newValue)){ // Value is a tag
+                return std::unexpected<Error>({Error::Type::INVALID_INLINE_ASSIGNMENT, std::string(arg)});
             }
+            if(newValue.empty()){ // No value
+                return std::unexpected<Error>({Error::Type::EMPTY_OPTION_VALUE, std::string(arg)});
+            }
+            p_commandLine.push_back(newTag);
+            p_commandLine.push_back(newValue);
         }
         return {}; // Successful void return
-    } // #END: preprocess(std::vector<std::string>&)
+    } // #END: preprocess(const std::span<char* const>, const bool, std::vector<std::string_view>&)
 
-    // #FUNCTION: bind(const std::shared_ptr<Argument>, const std::string&), Method
-    std::expected<void, Error> Parser::bind(const std::shared_ptr<Argument>& p_bindable, const std::string& p_value)const{
+    // #FUNCTION: bind(const std::shared_ptr<Argument>, const std::string_view), Method
+    std::expected<void, Error> Parser::bind(const std::shared_ptr<Argument>& p_bindable, const std::string_view p_value)const{
         if(auto bindable = std::dynamic_pointer_cast<Bindable>(p_bindable)){
-            if(!isValidValue(p_value)){
-                return std::unexpected<Error>({Error::Type::INVALID_VALUE, p_value});
+            if(!isStandardInput(*bindable, p_value) && !isValidValue(p_value)){
+                return std::unexpected<Error>({Error::Type::INVALID_VALUE, std::string(p_value)});
             }
             return bindable->bind(p_value); 
         }else{
             return std::unexpected<Error>({Error::Type::NOT_BINDABLE});
         }
-    } // #END: bind(const std::shared_ptr<Argument>, const std::string&)
+    } // #END: bind(const std::shared_ptr<Argument>, const std::string_view)
 
-    // #FUNCTION: bind(const std::unique_ptr<Bindable>, const std::string&), Method
-    std::expected<void, Error> Parser::bind(const std::unique_ptr<Bindable>& p_bindable, const std::string& p_value)const{
-        if(!isValidValue(p_value)){
-            return std::unexpected<Error>({Error::Type::INVALID_VALUE, p_value});
+    // #FUNCTION: bind(const std::unique_ptr<Bindable>, const std::string_view), Method
+    std::expected<void, Error> Parser::bind(const std::unique_ptr<Bindable>& p_bindable, const std::string_view p_value)const{
+        if(!isStandardInput(*p_bindable, p_value) && !isValidValue(p_value)){
+            return std::unexpected<Error>({Error::Type::INVALID_VALUE, std::string(p_value)});
         }
         return p_bindable->bind(p_value); 
-    } // #END: bind(const std::unique_ptr<Bindable>, const std::string&)
+    } // #END: bind(const std::unique_ptr<Bindable>, const std::string_view)
 
     // #FUNCTION: flag(const std::shared_ptr<Argument>), Method
     std::expected<void, Error> Parser::flag(const std::shared_ptr<Argument>& p_flaggable)const{
@@ -247,13 +357,277 @@ namespace simpleCli{ // #SCOPE: simpleCli
         }
     } // #END: callback(const std::shared_ptr<Argument>)
 
-    // #FUNCTION: getArgument(const std::string&), Const Method
-    std::shared_ptr<Argument> Parser::getArgument(const std::string& p_tag)const{
+    // #FUNCTION: getArgument(const std::string_view), Const Method
+    std::shared_ptr<Argument> Parser::getArgument(const std::string_view p_tag)const{
         if(auto it = m_arguments.find(p_tag); it != m_arguments.end()){
             return it->second;
         }
         return nullptr;
-    } // #END: getArgument(const std::string&)
+    } // #END: getArgument(const std::string_view)
+
+    // #FUNCTION: tokenize(const std::string_view), Method
+    std::expected<void, Error> Parser::tokenize(const std::string_view p_commandLine){
+        m_tokenBuffer.clear();
+        m_tokenOffsets.clear();
+        m_tokenBuffer.reserve(p_commandLine.size() + p_commandLine.size() / 2 + 2); // Unescaped text plus terminators never exceeds this
+        bool inToken = false;
+        auto startToken = [&](){
+            if(!inToken){
+                inToken = true;
+                m_tokenOffsets.push_back(m_tokenBuffer.size());
+            }
+        };
+        auto endToken = [&](){
+            if(inToken){
+                inToken = false;
+                m_tokenBuffer.push_back('\0');
+            }
+        };
+        const char* const begin = p_commandLine.data();
+        const char* const end = begin + p_commandLine.size();
+        const char* position = begin;
+        while(position < end){
+            const char* special = findUnquotedSpecial(position, end);
+            if(special != position){ // Plain run
+                startToken();
+                m_tokenBuffer.append(position, special);
+            }
+            if(special == end){
+                break;
+            }
+            if(isSpace(*special)){ // Token boundary
+                endToken();
+                position = special + 1;
+            }else if(*special == '\\'){ // Escape
+                if(special + 1 == end){
+                    return std::unexpected<Error>({Error::Type::DANGLING_ESCAPE, "", static_cast<std::size_t>(special - begin)});
+                }
+                if(special[1] != '\n'){ // Escaped newline is a line continuation
+                    startToken();
+                    m_tokenBuffer.push_back(special[1]);
+                }
+                position = special + 2;
+            }else if(*special == '\''){ // Single quotes, everything literal
+                startToken();
+                const char* close = static_cast<const char*>(std::memchr(special + 1, '\'', end - special - 1));
+                if(!close){
+                    return std::unexpected<Error>({Error::Type::UNTERMINATED_QUOTE, "Single", static_cast<std::size_t>(special - begin)});
+                }
+                m_tokenBuffer.append(special + 1, close);
+                position = close + 1;
+            }else{ // Double quotes, backslash only escapes $ ` " \ and newline
+                startToken();
+                const char* quoted = special + 1;
+                while(true){
+                    const char* next = findDoubleQuotedSpecial(quoted, end);
+                    if(next == end || (*next == '\\' && next + 1 == end)){
+                        return std::unexpected<Error>({Error::Type::UNTERMINATED_QUOTE, "Double", static_cast<std::size_t>(special - begin)});
+                    }
+                    m_tokenBuffer.append(quoted, next);
+                    if(*next == '"'){
+                        position = next + 1;
+                        break;
+                    }
+                    const char escaped = next[1];
+                    if(escaped == '$' || escaped == '`' || escaped == '"' || escaped == '\\'){
+                        m_tokenBuffer.push_back(escaped);
+                    }else if(escaped != '\n'){ // Backslash stays literal
+                        m_tokenBuffer.push_back('\\');
+                        m_tokenBuffer.push_back(escaped);
+                    }
+                    quoted = next + 2;
+                }
+            }
+        }
+        endToken();
+        m_tokenArguments.clear();
+        for(const std::size_t offset: m_tokenOffsets){
+            m_tokenArguments.push_back(m_tokenBuffer.data() + offset);
+        }
+        return {}; // Successful void return
+    } // #END: tokenize(const std::string_view)
+
+    // #FUNCTION: reserveIndex(const std::initializer_list<std::string_view>), Method
+    std::expected<std::size_t, Error> Parser::reserveIndex(const std::initializer_list<std::string_view> p_tags){
+        for(auto it = p_tags.begin(); it != p_tags.end(); it++){
+            if(!isValidTag(*it)) return std::unexpected<Error>({Error::Type::INVALID_TAG, std::string(*it)});
+            if(!isUniqueTag(*it) || std::find(p_tags.begin(), it, *it) != it) return std::unexpected<Error>({Error::Type::REPEATED_TAG, std::string(*it)});
+        }
+        // Every tag is checked before any is registered, so a rejected call uses no index
+        m_names.emplace_back(p_tags.size() ? *p_tags.begin() : std::string_view());
+        return m_names.size() - 1;
+    } // #END: reserveIndex(const std::initializer_list<std::string_view>)
+
+    // #FUNCTION: isStopFlag(const std::string_view), Const Method
+    bool Parser::isStopFlag(const std::string_view p_arg)const{
+        if(m_stops.empty()){ // No lookup when no stop flag is set
+            return false;
+        }
+        auto it = m_arguments.find(p_arg);
+        return it != m_arguments.end() && hasBit(m_stops, it->second->index());
+    } // #END: isStopFlag(const std::string_view)
+
+    // #FUNCTION: getIndex(const std::string_view), Const Method
+    std::expected<std::size_t, Error> Parser::getIndex(const std::string_view p_tag)const{
+        if(auto argument = getArgument(p_tag)){
+            return argument->index();
+        }
+        return std::unexpected<Error>({Error::Type::INVALID_TAG, std::string(p_tag)});
+    } // #END: getIndex(const std::string_view)
+
+    // #FUNCTION: getRules(const std::size_t), Method
+    Parser::Rules& Parser::getRules(const std::size_t p_index){
+        if(p_index >= m_rules.size()){
+            m_rules.resize(p_index + 1);
+        }
+        return m_rules[p_index];
+    } // #END: getRules(const std::size_t)
+
+    // #FUNCTION: checkConstraints(const Mask&), Const Method
+    std::expected<void, Error> Parser::checkConstraints(const Mask& p_seen)const{
+        auto seenWord = [&p_seen](const std::size_t p_word)->std::uint64_t{
+            return p_word < p_seen.size() ? p_seen[p_word] : 0;
+        };
+        for(std::size_t word = 0; word < m_required.size(); word++){ // All required arguments in one compare per word
+            if(const std::uint64_t missing = m_required[word] & ~seenWord(word)){
+                return std::unexpected<Error>({Error::Type::MISSING_REQUIRED_ARGUMENT, m_names[word * 64 + std::countr_zero(missing)]});
+            }
+        }
+        for(std::size_t word = 0; word < p_seen.size(); word++){ // Only rules of given arguments are visited
+            for(std::uint64_t bits = p_seen[word]; bits; bits &= bits - 1){
+                const std::size_t index = word * 64 + std::countr_zero(bits);
+                if(index >= m_rules.size()){
+                    break;
+                }
+                const Rules& rules = m_rules[index];
+                for(std::size_t other = 0; other < rules.conflicts.size(); other++){
+                    if(const std::uint64_t conflicts = rules.conflicts[other] & seenWord(other)){
+                        return std::unexpected<Error>({Error::Type::CONFLICTING_ARGUMENTS, m_names[index] + ", " + m_names[other * 64 + std::countr_zero(conflicts)]});
+                    }
+                }
+                for(std::size_t other = 0; other < rules.dependencies.size(); other++){
+                    if(const std::uint64_t missing = rules.dependencies[other] & ~seenWord(other)){
+                        return std::unexpected<Error>({Error::Type::MISSING_DEPENDENCY, m_names[index] + " Requires " + m_names[other * 64 + std::countr_zero(missing)]});
+                    }
+                }
+                for(const auto& check: rules.values){
+                    if(auto result = check(); !result){
+                        return result;
+                    }
+                }
+            }
+        }
+        return {}; // Successful void return
+    } // #END: checkConstraints(const Mask&)
+
+// #DIV: Private Static Methods
+
+    // #FUNCTION: isValidTag(const std::string_view), Static Method
+    bool Parser::isValidTag(const std::string_view p_tag){
+        if(p_tag == END_OF_OPTIONS){ // Reserved terminator
+            return false;
+        }else if(p_tag.size() >= LONG_TAG_MIN_SIZE){ // Long Tag
+            return p_tag[0] == '-' && p_tag[1] == '-';
+        }else if(p_tag.size() == SHORT_TAG_SIZE){ // Short Tag
+            return p_tag[0] == '-';
+        }else{
+            return false;
+        }
+    } // #END: isValidTag(const std::string_view)
+
+    // #FUNCTION: isValidValue(const std::string_view), Static Method
+    bool Parser::isValidValue(const std::string_view p_value){
+        if(p_value.size() == 1 && p_value[0] == '-'){ // Single dash is not valid value
+            return false;
+        }
+        if(p_value.size() == 2 && p_value[0] == '-'){ // Looks like a short tag
+            return p_value[1] >= '0' && p_value[1] <= '9'; // Is a negative single digit number
+        }
+        if(p_value.size() > 2 && p_value[0] == '-' && p_value[1] == '-') return false; // Invalid long tag
+        return true;
+    } // #END: isValidValue(const std::string_view)
+
+    // #FUNCTION: isSpace(const char), Static Method
+    bool Parser::isSpace(const char p_char){
+        return p_char == ' ' || p_char == '\t' || p_char == '\n' || p_char == '\r';
+    } // #END: isSpace(const char)
+
+    // #FUNCTION: findUnquotedSpecial(const char*, const char* const), Static Method
+    const char* Parser::findUnquotedSpecial(const char* p_begin, const char* const p_end){
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+        // Compare 16 bytes per step against every character that ends a plain run
+        const __m128i space = _mm_set1_epi8(' ');
+        const __m128i tab = _mm_set1_epi8('\t');
+        const __m128i newline = _mm_set1_epi8('\n');
+        const __m128i carriage = _mm_set1_epi8('\r');
+        const __m128i single = _mm_set1_epi8('\'');
+        const __m128i quote = _mm_set1_epi8('"');
+        const __m128i escape = _mm_set1_epi8('\\');
+        while(p_end - p_begin >= 16){
+            const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_begin));
+            __m128i hits = _mm_or_si128(_mm_cmpeq_epi8(chunk, space), _mm_cmpeq_epi8(chunk, tab));
+            hits = _mm_or_si128(hits, _mm_or_si128(_mm_cmpeq_epi8(chunk, newline), _mm_cmpeq_epi8(chunk, carriage)));
+            hits = _mm_or_si128(hits, _mm_or_si128(_mm_cmpeq_epi8(chunk, single), _mm_cmpeq_epi8(chunk, quote)));
+            hits = _mm_or_si128(hits, _mm_cmpeq_epi8(chunk, escape));
+            if(const unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(hits))){
+                return p_begin + std::countr_zero(mask);
+            }
+            p_begin += 16;
+        }
+#endif
+        for(; p_begin != p_end; p_begin++){
+            if(isSpace(*p_begin) || *p_begin == '\'' || *p_begin == '"' || *p_begin == '\\'){
+                break;
+            }
+        }
+        return p_begin;
+    } // #END: findUnquotedSpecial(const char*, const char* const)
+
+    // #FUNCTION: findDoubleQuotedSpecial(const char*, const char* const), Static Method
+    const char* Parser::findDoubleQuotedSpecial(const char* p_begin, const char* const p_end){
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+        const __m128i quote = _mm_set1_epi8('"');
+        const __m128i escape = _mm_set1_epi8('\\');
+        while(p_end - p_begin >= 16){
+            const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_begin));
+            const __m128i hits = _mm_or_si128(_mm_cmpeq_epi8(chunk, quote), _mm_cmpeq_epi8(chunk, escape));
+            if(const unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(hits))){
+                return p_begin + std::countr_zero(mask);
+            }
+            p_begin += 16;
+        }
+#endif
+        for(; p_begin != p_end; p_begin++){
+            if(*p_begin == '"' || *p_begin == '\\'){
+                break;
+            }
+        }
+        return p_begin;
+    } // #END: findDoubleQuotedSpecial(const char*, const char* const)
+
+    // #FUNCTION: hasBit(const Mask&, const std::size_t), Static Method
+    bool Parser::hasBit(const Mask& p_mask, const std::size_t p_index){
+        return p_index / 64 < p_mask.size() && (p_mask[p_index / 64] >> (p_index % 64)) & 1;
+    } // #END: hasBit(const Mask&, const std::size_t)
+
+    // #FUNCTION: setBit(Mask&, const std::size_t), Static Method
+    void Parser::setBit(Mask& p_mask, const std::size_t p_index){
+        if(p_index / 64 >= p_mask.size()){
+            p_mask.resize(p_index / 64 + 1);
+        }
+        p_mask[p_index / 64] |= std::uint64_t(1) << (p_index % 64);
+    } // #END: setBit(Mask&, const std::size_t)
+
+// #SCOPE: Parser::TagHash
+
+// #DIV: Public Methods
+
+    // #FUNCTION: operator()(const std::string_view), Const Method
+    std::size_t Parser::TagHash::operator()(const std::string_view p_tag)const{
+        return std::hash<std::string_view>{}(p_tag);
+    } // #END: operator()(const std::string_view)
+
+// #END: Parser::TagHash
 
 // #END: Parser
 
@@ -11,6 +11,16 @@
 
 namespace simpleCli{ // #SCOPE: simpleCli
 
+    // #STRUCT: ParseResult, Final Struct
+    MODULE_EXPORT struct ParseResult final{
+    // Methods
+        explicit operator bool()const;
+    // Members
+        bool parsed = false; // Any arguments were given
+        bool stopped = false; // Parsing ended at END_OF_OPTIONS or a stop flag
+        std::span<char*> remainder; // Unparsed tail, a view into argv
+    }; // #END: ParseResult
+
     // #CLASS: Parser, Class
     MODULE_EXPORT class Parser{
     public:
@@ -18,47 +28,96 @@ namespace simpleCli{ // #SCOPE: simpleCli
         Parser() = default;
         ~Parser() = default;
     // Public Methods
-        std::expected<bool, Error> parse(const int argc, char** const argv)const;
+        std::expected<ParseResult, Error> parse(const int argc, char** const argv)const;
+        std::expected<ParseResult, Error> parse(const std::string_view p_commandLine);
         std::expected<void, Error> addFlag(const std::initializer_list<std::string_view> p_tags, bool& p_bind);
         std::expected<void, Error> addFlag(const std::initializer_list<std::string_view> p_tags, const std::function<void()>& p_callback);
         std::expected<void, Error> addFlag(const std::initializer_list<std::string_view> p_tags, std::function<void()>&& p_callback);
         std::expected<void, Error> addFlag(const std::initializer_list<std::string_view> p_tags, bool& p_bind, const std::function<void()>& p_callback);
         std::expected<void, Error> addFlag(const std::initializer_list<std::string_view> p_tags, bool& p_bind, std::function<void()>&& p_callback);
-        template<class T_Bind> std::expected<void, Error> addOption(const std::initializer_list<std::string_view> p_tags, T_Bind& p_bind, const Converter<T_Bind>& p_converter = &Argument::convert<T_Bind>);
+        std::expected<void, Error> setStopFlag(const std::initializer_list<std::string_view> p_tags);
+        std::expected<void, Error> addRequired(const std::initializer_list<std::string_view> p_tags);
+        std::expected<void, Error> addConflict(const std::initializer_list<std::string_view> p_tags);
+        std::expected<void, Error> addDependency(const std::string_view p_tag, const std::initializer_list<std::string_view> p_dependencies);
+        template<class T_Bind> std::expected<void, Error> addRange(const std::string_view p_tag, const T_Bind& p_min, const T_Bind& p_max);
+        template<class T_Bind> std::expected<void, Error> addAllowed(const std::string_view p_tag, const std::initializer_list<T_Bind> p_values);
+        template<class T_Bind> std::expected<void, Error> addOption(const std::initializer_list<std::string_view> p_tags, T_Bind& p_bind, const Converter<T_Bind>& p_converter = Argument::bindConverter<T_Bind>());
         template<class T_Bind> std::expected<void, Error> addOption(const std::initializer_list<std::string_view> p_tags, T_Bind& p_bind, Converter<T_Bind>&& p_converter);
-        template<class T_Bind> std::expected<void, Error> addOption(const std::initializer_list<std::string_view> p_tags, T_Bind& p_bind, const T_Bind& p_default, const Converter<T_Bind>& p_converter = &Argument::convert<T_Bind>);
+        template<class T_Bind> std::expected<void, Error> addOption(const std::initializer_list<std::string_view> p_tags, T_Bind& p_bind, const T_Bind& p_default, const Converter<T_Bind>& p_converter = Argument::bindConverter<T_Bind>());
         template<class T_Bind> std::expected<void, Error> addOption(const std::initializer_list<std::string_view> p_tags, T_Bind& p_bind, const T_Bind& p_default, Converter<T_Bind>&& p_converter);
-        template<class T_Bind> std::expected<void, Error> addRepeatableOption(const std::initializer_list<std::string_view> p_tags, std::vector<T_Bind>& p_bind, const Converter<T_Bind>& p_converter = &Argument::convert<T_Bind>);
+        template<class T_Bind> std::expected<void, Error> addRepeatableOption(const std::initializer_list<std::string_view> p_tags, std::vector<T_Bind>& p_bind, const Converter<T_Bind>& p_converter = Argument::bindConverter<T_Bind>());
         template<class T_Bind> std::expected<void, Error> addRepeatableOption(const std::initializer_list<std::string_view> p_tags, std::vector<T_Bind>& p_bind, Converter<T_Bind>&& p_converter);
-        template<class T_Bind> std::expected<void, Error> addRepeatableOption(const std::initializer_list<std::string_view> p_tags, std::vector<T_Bind>& p_bind, const std::vector<T_Bind>& p_default, const Converter<T_Bind>& p_converter = &Argument::convert<T_Bind>);
+        template<class T_Bind> std::expected<void, Error> addRepeatableOption(const std::initializer_list<std::string_view> p_tags, std::vector<T_Bind>& p_bind, const std::vector<T_Bind>& p_default, const Converter<T_Bind>& p_converter = Argument::bindConverter<T_Bind>());
         template<class T_Bind> std::expected<void, Error> addRepeatableOption(const std::initializer_list<std::string_view> p_tags, std::vector<T_Bind>& p_bind, const std::vector<T_Bind>& p_default, Converter<T_Bind>&& p_converter);
-        template<class T_Bind> std::expected<void, Error> addContinuousOption(const std::initializer_list<std::string_view> p_tags, std::vector<T_Bind>& p_bind, const Converter<T_Bind>& p_converter = &Argument::convert<T_Bind>);
+        template<class T_Bind> std::expected<void, Error> addContinuousOption(const std::initializer_list<std::string_view> p_tags, std::vector<T_Bind>& p_bind, const Converter<T_Bind>& p_converter = Argument::bindConverter<T_Bind>());
         template<class T_Bind> std::expected<void, Error> addContinuousOption(const std::initializer_list<std::string_view> p_tags, std::vector<T_Bind>& p_bind, Converter<T_Bind>&& p_converter);
-        template<class T_Bind> std::expected<void, Error> addContinuousOption(const std::initializer_list<std::string_view> p_tags, std::vector<T_Bind>& p_bind, const std::vector<T_Bind>& p_default, const Converter<T_Bind>& p_converter = &Argument::convert<T_Bind>);
+        template<class T_Bind> std::expected<void, Error> addContinuousOption(const std::initializer_list<std::string_view> p_tags, std::vector<T_Bind>& p_bind, const std::vector<T_Bind>& p_default, const Converter<T_Bind>& p_converter = Argument::bindConverter<T_Bind>());
         template<class T_Bind> std::expected<void, Error> addContinuousOption(const std::initializer_list<std::string_view> p_tags, std::vector<T_Bind>& p_bind, const std::vector<T_Bind>& p_default, Converter<T_Bind>&& p_converter);
-        template<class T_Bind> void addPositional(std::vector<T_Bind>& p_bind, const Converter<T_Bind>& p_converter = &Argument::convert<T_Bind>);
+        template<class T_Bind> void addPositional(std::vector<T_Bind>& p_bind, const Converter<T_Bind>& p_converter = Argument::bindConverter<T_Bind>());
         template<class T_Bind> void addPositional(std::vector<T_Bind>& p_bind, Converter<T_Bind>&& p_converter);
-        template<class T_Bind> void addProgram(T_Bind& p_bind, const Converter<T_Bind>& p_converter = &Argument::convert<T_Bind>);
+        template<class T_Bind> void addPositional(PositionalStream<T_Bind>& p_bind, const Converter<T_Bind>& p_converter = &Argument::convert<T_Bind>);
+        template<class T_Bind> void addPositional(PositionalStream<T_Bind>& p_bind, Converter<T_Bind>&& p_converter);
+        template<class T_Bind> std::expected<void, Error> addPositionalSource(const std::initializer_list<std::string_view> p_tags, PositionalStream<T_Bind>& p_bind);
+        template<class T_Bind> void addProgram(T_Bind& p_bind, const Converter<T_Bind>& p_converter = Argument::bindConverter<T_Bind>());
         template<class T_Bind> void addProgram(T_Bind& p_bind, Converter<T_Bind>&& p_converter);
     // Public Members
         static inline constexpr std::uint8_t SHORT_TAG_SIZE = 2;
         static inline constexpr std::uint8_t LONG_TAG_MIN_SIZE = 4;
         static inline constexpr char OPTION_VALUE_SEPARATOR = '=';
+        static inline constexpr std::string_view END_OF_OPTIONS = "--";
     private:
+    // Private Types
+        struct TagHash{
+            using is_transparent = void; // Allows lookup by std::string_view
+            std::size_t operator()(const std::string_view p_tag)const;
+        };
+        using Mask = std::vector<std::uint64_t>; // One bit per argument index
+        struct Rules{
+            Mask conflicts; // Arguments that may not appear alongside this one
+            Mask dependencies; // Arguments that must appear alongside this one
+            std::vector<std::function<std::expected<void, Error>()>> values; // Checks on the bound value
+        };
     // Private Methods
-        bool isUniqueTag(const std::string& p_tag)const;
-        bool isValidTag(const std::string& p_tag)const;
-        bool isValidValue(const std::string& p_value)const;
-        std::expected<void, Error> preprocess(std::vector<std::string>& p_commandLine)const;
-        std::expected<void, Error> bind(const std::shared_ptr<Argument>& p_bindable, const std::string& p_value)const;
-        std::expected<void, Error> bind(const std::unique_ptr<Bindable>& p_bindable, const std::string& p_value)const;
+        bool isUniqueTag(const std::string_view p_tag)const;
+        bool isStandardInput(const Argument& p_bindable, const std::string_view p_value)const;
+        std::expected<ParseResult, Error> parseArguments(const int argc, char** const argv, const bool p_keepEmpty)const;
+        std::expected<void, Error> preprocess(const std::span<char* const> p_arguments, const bool p_keepEmpty, std::vector<std::string_view>& p_commandLine)const;
+        std::expected<void, Error> bind(const std::shared_ptr<Argument>& p_bindable, const std::string_view p_value)const;
+        std::expected<void, Error> bind(const std::unique_ptr<Bindable>& p_bindable, const std::string_view p_value)const;
         std::expected<void, Error> flag(const std::shared_ptr<Argument>& p_flaggable)const;
         std::expected<void, Error> callback(const std::shared_ptr<Argument>& p_callable)const;
-        std::shared_ptr<Argument> getArgument(const std::string& p_tag)const;
+        std::shared_ptr<Argument> getArgument(const std::string_view p_tag)const;
+        std::expected<void, Error> tokenize(const std::string_view p_commandLine);
+        std::expected<std::size_t, Error> reserveIndex(const std::initializer_list<std::string_view> p_tags);
+        bool isStopFlag(const std::string_view p_arg)const;
+        std::expected<std::size_t, Error> getIndex(const std::string_view p_tag)const;
+        Rules& getRules(const std::size_t p_index);
+        std::expected<void, Error> checkConstraints(const Mask& p_seen)const;
+        template<class T_Argument, class... T_Args> std::expected<void, Error> addArgument(const std::initializer_list<std::string_view> p_tags, const T_Args&... p_args);
+        template<class T_Bind> std::expected<void, Error> addValueCheck(const std::string_view p_tag, const std::function<bool(const T_Bind&)>& p_check, const Error::Type p_type);
+    // Private Static Methods
+        static bool isValidTag(const std::string_view p_tag);
+        static bool isValidValue(const std::string_view p_value);
+        static bool isSpace(const char p_char);
+        static const char* findUnquotedSpecial(const char* p_begin, const char* const p_end);
+        static const char* findDoubleQuotedSpecial(const char* p_begin, const char* const p_end);
+        static bool hasBit(const Mask& p_mask, const std::size_t p_index);
+        static void setBit(Mask& p_mask, const std::size_t p_index);
     // Private Members
-        std::unordered_map<std::string, std::shared_ptr<Argument>> m_arguments;
+        std::unordered_map<std::string, std::shared_ptr<Argument>, TagHash, std::equal_to<>> m_arguments;
         std::unique_ptr<Bindable> m_positionals;
         std::unique_ptr<Bindable> m_program;
+        Mask m_stops; // Flags that end parsing, by argument index
+        std::vector<std::string> m_names; // First tag by argument index
+        std::vector<Rules> m_rules; // Constraint rules by argument index
+        Mask m_required; // Arguments that must appear
+        bool m_constrained = false; // Any constraint registered
+        std::string m_tokenBuffer; // Unescaped null terminated tokens of the last string parse
+        std::vector<std::size_t> m_tokenOffsets; // Token starts in m_tokenBuffer
+        std::vector<char*> m_tokenArguments; // argv view over m_tokenBuffer
+    // Friends
+        template<class T_Config> friend class Schema;
+        template<std::size_t T_MaxTags, std::size_t T_MaxTokens> friend class StaticParser; // Shares what counts as a tag and a value
     }; // #END: Parser
 
 } // #END: simpleCli
@@ -12,33 +12,39 @@ namespace simpleCli{ // #SCOPE: simpleCli
 
     // #FUNCTION: addOption(const std::initializer_list<std::string_view>, T_Bind&, const Converter<T_Bind>&), Template Method
     template<class T_Bind> std::expected<void, Error> Parser::addOption(const std::initializer_list<std::string_view> p_tags, T_Bind& p_bind, const Converter<T_Bind>& p_converter){
+        const std::expected<std::size_t, Error> index = reserveIndex(p_tags);
+        if(!index) return std::unexpected<Error>(index.error());
         for(const std::string_view& tagView: p_tags){
             std::string tag = std::string(tagView);
-            if(!isValidTag(tag)) return std::unexpected<Error>({Error::Type::INVALID_TAG, std::move(tag)});
-            if(!isUniqueTag(tag)) return std::unexpected<Error>({Error::Type::REPEATED_TAG, std::move(tag)});
-            m_arguments[std::move(tag)] = std::shared_ptr<Argument>(new Option<T_Bind>(&p_bind, p_converter));
+            std::shared_ptr<Argument> argument = std::shared_ptr<Argument>(new Option<T_Bind>(&p_bind, p_converter));
+            argument->setIndex(index.value());
+            m_arguments[std::move(tag)] = std::move(argument);
         }
         return {}; // #END: addOption(const std::initializer_list<std::string_view>, T_Bind&, const Converter<T_Bind>&)
     } // #END: 
 
     // #FUNCTION: addOption(const std::initializer_list<std::string_view>, T_Bind&, Converter<T_Bind>&&), Template Method
     template<class T_Bind> std::expected<void, Error> Parser::addOption(const std::initializer_list<std::string_view> p_tags, T_Bind& p_bind, Converter<T_Bind>&& p_converter){
+        const std::expected<std::size_t, Error> index = reserveIndex(p_tags);
+        if(!index) return std::unexpected<Error>(index.error());
         for(const std::string_view& tagView: p_tags){
             std::string tag = std::string(tagView);
-            if(!isValidTag(tag)) return std::unexpected<Error>({Error::Type::INVALID_TAG, std::move(tag)});
-            if(!isUniqueTag(tag)) return std::unexpected<Error>({Error::Type::REPEATED_TAG, std::move(tag)});
-            m_arguments[std::move(tag)] = std::shared_ptr<Argument>(new Option<T_Bind>(&p_bind, std::move(p_converter)));
+            std::shared_ptr<Argument> argument = std::shared_ptr<Argument>(new Option<T_Bind>(&p_bind, std::move(p_converter)));
+            argument->setIndex(index.value());
+            m_arguments[std::move(tag)] = std::move(argument);
         }
         return {}; // #END: addOption(const std::initializer_list<std::string_view>, T_Bind&, Converter<T_Bind>&&)
     } // #END: 
 
     // #FUNCTION: addOption(const std::initializer_list<std::string_view>, T_Bind&, const T_Bind&, const Converter<T_Bind>&), Template Method
     template<class T_Bind> std::expected<void, Error> Parser::addOption(const std::initializer_list<std::string_view> p_tags, T_Bind& p_bind, const T_Bind& p_default, const Converter<T_Bind>& p_converter){
+        const std::expected<std::size_t, Error> index = reserveIndex(p_tags);
+        if(!index) return std::unexpected<Error>(index.error());
         for(const std::string_view& tagView: p_tags){
             std::string tag = std::string(tagView);
-            if(!isValidTag(tag)) return std::unexpected<Error>({Error::Type::INVALID_TAG, std::move(tag)});
-            if(!isUniqueTag(tag)) return std::unexpected<Error>({Error::Type::REPEATED_TAG, std::move(tag)});
-            m_arguments[std::move(tag)] = std::shared_ptr<Argument>(new Option<T_Bind>(&p_bind, p_converter));
+            std::shared_ptr<Argument> argument = std::shared_ptr<Argument>(new Option<T_Bind>(&p_bind, p_converter));
+            argument->setIndex(index.value());
+            m_arguments[std::move(tag)] = std::move(argument);
             p_bind = p_default;
         }
         return {};
@@ -46,11 +52,13 @@ namespace simpleCli{ // #SCOPE: simpleCli
 
     // #FUNCTION: addOption(const std::initializer_list<std::string_view>, T_Bind&, const T_Bind&, Converter<T_Bind>&&), Template Method
     template<class T_Bind> std::expected<void, Error> Parser::addOption(const std::initializer_list<std::string_view> p_tags, T_Bind& p_bind, const T_Bind& p_default, Converter<T_Bind>&& p_converter){
+        const std::expected<std::size_t, Error> index = reserveIndex(p_tags);
+        if(!index) return std::unexpected<Error>(index.error());
         for(const std::string_view& tagView: p_tags){
             std::string tag = std::string(tagView);
-            if(!isValidTag(tag)) return std::unexpected<Error>({Error::Type::INVALID_TAG, std::move(tag)});
-            if(!isUniqueTag(tag)) return std::unexpected<Error>({Error::Type::REPEATED_TAG, std::move(tag)});
-            m_arguments[std::move(tag)] = std::shared_ptr<Argument>(new Option<T_Bind>(&p_bind, std::move(p_converter)));
+            std::shared_ptr<Argument> argument = std::shared_ptr<Argument>(new Option<T_Bind>(&p_bind, std::move(p_converter)));
+            argument->setIndex(index.value());
+            m_arguments[std::move(tag)] = std::move(argument);
             p_bind = p_default;
         }
         return {};
@@ -58,33 +66,39 @@ namespace simpleCli{ // #SCOPE: simpleCli
 
     // #FUNCTION: addRepeatableOption(const std::initializer_list<std::string_view>, std::vector<T_Bind>&, const Converter<T_Bind>&), Template Method
     template<class T_Bind> std::expected<void, Error> Parser::addRepeatableOption(const std::initializer_list<std::string_view> p_tags, std::vector<T_Bind>& p_bind, const Converter<T_Bind>& p_converter){
+        const std::expected<std::size_t, Error> index = reserveIndex(p_tags);
+        if(!index) return std::unexpected<Error>(index.error());
         for(const std::string_view& tagView: p_tags){
             std::string tag = std::string(tagView);
-            if(!isValidTag(tag)) return std::unexpected<Error>({Error::Type::INVALID_TAG, std::move(tag)});
-            if(!isUniqueTag(tag)) return std::unexpected<Error>({Error::Type::REPEATED_TAG, std::move(tag)});
-            m_arguments[std::move(tag)] = std::shared_ptr<Argument>(new RepeatableOption<T_Bind>(&p_bind, p_converter));
+            std::shared_ptr<Argument> argument = std::shared_ptr<Argument>(new RepeatableOption<T_Bind>(&p_bind, p_converter));
+            argument->setIndex(index.value());
+            m_arguments[std::move(tag)] = std::move(argument);
         }
         return {};
     } // #END: addRepeatableOption(const std::initializer_list<std::string_view>, std::vector<T_Bind>&, const Converter<T_Bind>&)
 
     // #FUNCTION: addRepeatableOption(const std::initializer_list<std::string_view>, std::vector<T_Bind>&, Converter<T_Bind>&&), Template Method
     template<class T_Bind> std::expected<void, Error> Parser::addRepeatableOption(const std::initializer_list<std::string_view> p_tags, std::vector<T_Bind>& p_bind, Converter<T_Bind>&& p_converter){
+        const std::expected<std::size_t, Error> index = reserveIndex(p_tags);
+        if(!index) return std::unexpected<Error>(index.error());
         for(const std::string_view& tagView: p_tags){
             std::string tag = std::string(tagView);
-            if(!isValidTag(tag)) return std::unexpected<Error>({Error::Type::INVALID_TAG, std::move(tag)});
-            if(!isUniqueTag(tag)) return std::unexpected<Error>({Error::Type::REPEATED_TAG, std::move(tag)});
-            m_arguments[std::move(tag)] = std::shared_ptr<Argument>(new RepeatableOption<T_Bind>(&p_bind, std::move(p_converter)));
+            std::shared_ptr<Argument> argument = std::shared_ptr<Argument>(new RepeatableOption<T_Bind>(&p_bind, std::move(p_converter)));
+            argument->setIndex(index.value());
+            m_arguments[std::move(tag)] = std::move(argument);
         }
         return {};
     } // #END: addRepeatableOption(const std::initializer_list<std::string_view>, std::vector<T_Bind>&, Converter<T_Bind>&&)
 
     // #FUNCTION: addRepeatableOption(const std::initializer_list<std::string_view>, std::vector<T_Bind>&, const std::vector<T_Bind>&, const Converter<T_Bind>&), Template Method
     template<class T_Bind> std::expected<void, Error> Parser::addRepeatableOption(const std::initializer_list<std::string_view> p_tags, std::vector<T_Bind>& p_bind, const std::vector<T_Bind>& p_default, const Converter<T_Bind>& p_converter){
+        const std::expected<std::size_t, Error> index = reserveIndex(p_tags);
+        if(!index) return std::unexpected<Error>(index.error());
         for(const std::string_view& tagView: p_tags){
             std::string tag = std::string(tagView);
-            if(!isValidTag(tag)) return std::unexpected<Error>({Error::Type::INVALID_TAG, std::move(tag)});
-            if(!isUniqueTag(tag)) return std::unexpected<Error>({Error::Type::REPEATED_TAG, std::move(tag)});
-            m_arguments[std::move(tag)] = std::shared_ptr<Argument>(new RepeatableOption<T_Bind>(&p_bind, p_converter));
+            std::shared_ptr<Argument> argument = std::shared_ptr<Argument>(new RepeatableOption<T_Bind>(&p_bind, p_converter));
+            argument->setIndex(index.value());
+            m_arguments[std::move(tag)] = std::move(argument);
             p_bind = p_default;
         }
         return {};
@@ -92,11 +106,13 @@ namespace simpleCli{ // #SCOPE: simpleCli
 
     // #FUNCTION: addRepeatableOption(const std::initializer_list<std::string_view>, std::vector<T_Bind>&, const std::vector<T_Bind>&, Converter<T_Bind>&&), Template Method
     template<class T_Bind> std::expected<void, Error> Parser::addRepeatableOption(const std::initializer_list<std::string_view> p_tags, std::vector<T_Bind>& p_bind, const std::vector<T_Bind>& p_default, Converter<T_Bind>&& p_converter){
+        const std::expected<std::size_t, Error> index = reserveIndex(p_tags);
+        if(!index) return std::unexpected<Error>(index.error());
         for(const std::string_view& tagView: p_tags){
             std::string tag = std::string(tagView);
-            if(!isValidTag(tag)) return std::unexpected<Error>({Error::Type::INVALID_TAG, std::move(tag)});
-            if(!isUniqueTag(tag)) return std::unexpected<Error>({Error::Type::REPEATED_TAG, std::move(tag)});
-            m_arguments[std::move(tag)] = std::shared_ptr<Argument>(new RepeatableOption<T_Bind>(&p_bind, std::move(p_converter)));
+            std::shared_ptr<Argument> argument = std::shared_ptr<Argument>(new RepeatableOption<T_Bind>(&p_bind, std::move(p_converter)));
+            argument->setIndex(index.value());
+            m_arguments[std::move(tag)] = std::move(argument);
             p_bind = p_default;
         }
         return {};
@@ -104,33 +120,39 @@ namespace simpleCli{ // #SCOPE: simpleCli
 
     // #FUNCTION: addContinuousOption(const std::initializer_list<std::string_view>, std::vector<T_Bind>&, const Converter<T_Bind>&), Template Method
     template<class T_Bind> std::expected<void, Error> Parser::addContinuousOption(const std::initializer_list<std::string_view> p_tags, std::vector<T_Bind>& p_bind, const Converter<T_Bind>& p_converter){
+        const std::expected<std::size_t, Error> index = reserveIndex(p_tags);
+        if(!index) return std::unexpected<Error>(index.error());
         for(const std::string_view& tagView: p_tags){
             std::string tag = std::string(tagView);
-            if(!isValidTag(tag)) return std::unexpected<Error>({Error::Type::INVALID_TAG, std::move(tag)});
-            if(!isUniqueTag(tag)) return std::unexpected<Error>({Error::Type::REPEATED_TAG, std::move(tag)});
-            m_arguments[std::move(tag)] = std::shared_ptr<Argument>(new ContinuousOption<T_Bind>(&p_bind, p_converter));
+            std::shared_ptr<Argument> argument = std::shared_ptr<Argument>(new ContinuousOption<T_Bind>(&p_bind, p_converter));
+            argument->setIndex(index.value());
+            m_arguments[std::move(tag)] = std::move(argument);
         }
         return {};
     } // #END: addContinuousOption(const std::initializer_list<std::string_view>, std::vector<T_Bind>&, const Converter<T_Bind>&)
 
     // #FUNCTION: addContinuousOption(const std::initializer_list<std::string_view>, std::vector<T_Bind>&, Converter<T_Bind>&&), Template Method
     template<class T_Bind> std::expected<void, Error> Parser::addContinuousOption(const std::initializer_list<std::string_view> p_tags, std::vector<T_Bind>& p_bind, Converter<T_Bind>&& p_converter){
+        const std::expected<std::size_t, Error> index = reserveIndex(p_tags);
+        if(!index) return std::unexpected<Error>(index.error());
         for(const std::string_view& tagView: p_tags){
             std::string tag = std::string(tagView);
-            if(!isValidTag(tag)) return std::unexpected<Error>({Error::Type::INVALID_TAG, std::move(tag)});
-            if(!isUniqueTag(tag)) return std::unexpected<Error>({Error::Type::REPEATED_TAG, std::move(tag)});
-            m_arguments[std::move(tag)] = std::shared_ptr<Argument>(new ContinuousOption<T_Bind>(&p_bind, std::move(p_converter)));
+            std::shared_ptr<Argument> argument = std::shared_ptr<Argument>(new ContinuousOption<T_Bind>(&p_bind, std::move(p_converter)));
+            argument->setIndex(index.value());
+            m_arguments[std::move(tag)] = std::move(argument);
         }
         return {};
     } // #END: addContinuousOption(const std::initializer_list<std::string_view>, std::vector<T_Bind>&, Converter<T_Bind>&&)
 
     // #FUNCTION: addContinuousOption(const std::initializer_list<std::string_view>, std::vector<T_Bind>&, const std::vector<T_Bind>&, const Converter<T_Bind>&), Template Method
     template<class T_Bind> std::expected<void, Error> Parser::addContinuousOption(const std::initializer_list<std::string_view> p_tags, std::vector<T_Bind>& p_bind, const std::vector<T_Bind>& p_default, const Converter<T_Bind>& p_converter){
+        const std::expected<std::size_t, Error> index = reserveIndex(p_tags);
+        if(!index) return std::unexpected<Error>(index.error());
         for(const std::string_view& tagView: p_tags){
             std::string tag = std::string(tagView);
-            if(!isValidTag(tag)) return std::unexpected<Error>({Error::Type::INVALID_TAG, std::move(tag)});
-            if(!isUniqueTag(tag)) return std::unexpected<Error>({Error::Type::REPEATED_TAG, std::move(tag)});
-            m_arguments[std::move(tag)] = std::shared_ptr<Argument>(new ContinuousOption<T_Bind>(&p_bind, p_converter));
+            std::shared_ptr<Argument> argument = std::shared_ptr<Argument>(new ContinuousOption<T_Bind>(&p_bind, p_converter));
+            argument->setIndex(index.value());
+            m_arguments[std::move(tag)] = std::move(argument);
             p_bind = p_default;
         }
         return {};
@@ -138,11 +160,13 @@ namespace simpleCli{ // #SCOPE: simpleCli
 
     // #FUNCTION: addContinuousOption(const std::initializer_list<std::string_view>, std::vector<T_Bind>&, const std::vector<T_Bind>&, Converter<T_Bind>&&), Template Method
     template<class T_Bind> std::expected<void, Error> Parser::addContinuousOption(const std::initializer_list<std::string_view> p_tags, std::vector<T_Bind>& p_bind, const std::vector<T_Bind>& p_default, Converter<T_Bind>&& p_converter){
+        const std::expected<std::size_t, Error> index = reserveIndex(p_tags);
+        if(!index) return std::unexpected<Error>(index.error());
         for(const std::string_view& tagView: p_tags){
             std::string tag = std::string(tagView);
-            if(!isValidTag(tag)) return std::unexpected<Error>({Error::Type::INVALID_TAG, std::move(tag)});
-            if(!isUniqueTag(tag)) return std::unexpected<Error>({Error::Type::REPEATED_TAG, std::move(tag)});
-            m_arguments[std::move(tag)] = std::shared_ptr<Argument>(new ContinuousOption<T_Bind>(&p_bind, p_converter));
+            std::shared_ptr<Argument> argument = std::shared_ptr<Argument>(new ContinuousOption<T_Bind>(&p_bind, p_converter));
+            argument->setIndex(index.value());
+            m_arguments[std::move(tag)] = std::move(argument);
             p_bind = p_default;
         }
         return {};
@@ -158,6 +182,29 @@ namespace simpleCli{ // #SCOPE: simpleCli
         m_positionals = std::make_unique<Positional<T_Bind>>(&p_bind, std::move(p_converter));
     } // #END: addPositional(const std::vector<T_Bind>&, Converter<T_Bind>&&)
 
+    // #FUNCTION: addPositional(PositionalStream<T_Bind>&, const Converter<T_Bind>&), Template Method
+    template<class T_Bind> void Parser::addPositional(PositionalStream<T_Bind>& p_bind, const Converter<T_Bind>& p_converter){
+        m_positionals = std::make_unique<StreamedPositional<T_Bind>>(&p_bind, p_converter);
+    } // #END: addPositional(PositionalStream<T_Bind>&, const Converter<T_Bind>&)
+
+    // #FUNCTION: addPositional(PositionalStream<T_Bind>&, Converter<T_Bind>&&), Template Method
+    template<class T_Bind> void Parser::addPositional(PositionalStream<T_Bind>& p_bind, Converter<T_Bind>&& p_converter){
+        m_positionals = std::make_unique<StreamedPositional<T_Bind>>(&p_bind, std::move(p_converter));
+    } // #END: addPositional(PositionalStream<T_Bind>&, Converter<T_Bind>&&)
+
+    // #FUNCTION: addPositionalSource(const std::initializer_list<std::string_view>, PositionalStream<T_Bind>&), Template Method
+    template<class T_Bind> std::expected<void, Error> Parser::addPositionalSource(const std::initializer_list<std::string_view> p_tags, PositionalStream<T_Bind>& p_bind){
+        const std::expected<std::size_t, Error> index = reserveIndex(p_tags);
+        if(!index) return std::unexpected<Error>(index.error());
+        for(const std::string_view& tagView: p_tags){
+            std::string tag = std::string(tagView);
+            std::shared_ptr<Argument> argument = std::shared_ptr<Argument>(new PositionalSource<T_Bind>(&p_bind));
+            argument->setIndex(index.value());
+            m_arguments[std::move(tag)] = std::move(argument);
+        }
+        return {};
+    } // #END: addPositionalSource(const std::initializer_list<std::string_view>, PositionalStream<T_Bind>&)
+
     // #FUNCTION: addProgram(const T_Bind&, const Converter<T_Bind>&), Template Method
     template<class T_Bind> void Parser::addProgram(T_Bind& p_bind, const Converter<T_Bind>& p_converter){
         m_program = std::make_unique<Program<T_Bind>>(&p_bind, p_converter);
@@ -168,6 +215,55 @@ namespace simpleCli{ // #SCOPE: simpleCli
         m_program = std::make_unique<Program<T_Bind>>(&p_bind, std::move(p_converter));
     } // #END: addProgram(const T_Bind&, Converter<T_Bind>&&)
 
+    // #FUNCTION: addRange(const std::string_view, const T_Bind&, const T_Bind&), Template Method
+    template<class T_Bind> std::expected<void, Error> Parser::addRange(const std::string_view p_tag, const T_Bind& p_min, const T_Bind& p_max){
+        return addValueCheck<T_Bind>(p_tag, [p_min, p_max](const T_Bind& p_value){
+            return !(p_value < p_min) && !(p_max < p_value);
+        }, Error::Type::VALUE_OUT_OF_RANGE);
+    } // #END: addRange(const std::string_view, const T_Bind&, const T_Bind&)
+
+    // #FUNCTION: addAllowed(const std::string_view, const std::initializer_list<T_Bind>), Template Method
+    template<class T_Bind> std::expected<void, Error> Parser::addAllowed(const std::string_view p_tag, const std::initializer_list<T_Bind> p_values){
+        return addValueCheck<T_Bind>(p_tag, [values = std::vector<T_Bind>(p_values)](const T_Bind& p_value){
+            return std::find(values.begin(), values.end(), p_value) != values.end();
+        }, Error::Type::VALUE_NOT_ALLOWED);
+    } // #END: addAllowed(const std::string_view, const std::initializer_list<T_Bind>)
+
+// #DIV: Private Methods
+
+    // #FUNCTION: addArgument<T_Argument, T_Args...>(const std::initializer_list<std::string_view>, const T_Args&...), Template Method
+    template<class T_Argument, class... T_Args> std::expected<void, Error> Parser::addArgument(const std::initializer_list<std::string_view> p_tags, const T_Args&... p_args){
+        const std::expected<std::size_t, Error> index = reserveIndex(p_tags);
+        if(!index) return std::unexpected<Error>(index.error());
+        for(const std::string_view& tagView: p_tags){
+            std::string tag = std::string(tagView);
+            std::shared_ptr<Argument> argument = std::shared_ptr<Argument>(new T_Argument(p_args...));
+            argument->setIndex(index.value());
+            m_arguments[std::move(tag)] = std::move(argument);
+        }
+        return {};
+    } // #END: addArgument<T_Argument, T_Args...>(const std::initializer_list<std::string_view>, const T_Args&...)
+
+    // #FUNCTION: addValueCheck(const std::string_view, const std::function<bool(const T_Bind&)>&, const Error::Type), Template Method
+    template<class T_Bind> std::expected<void, Error> Parser::addValueCheck(const std::string_view p_tag, const std::function<bool(const T_Bind&)>& p_check, const Error::Type p_type){
+        auto argument = getArgument(p_tag);
+        if(!argument) return std::unexpected<Error>({Error::Type::INVALID_TAG, std::string(p_tag)});
+        std::string tag = std::string(p_tag);
+        auto bound = std::dynamic_pointer_cast<Bound<T_Bind>>(argument);
+        if(!bound){
+            if(std::dynamic_pointer_cast<Bindable>(argument)){ // Binds a different type, such as an int literal for an unsigned option
+                return std::unexpected<Error>({Error::Type::TYPE_MISMATCH, std::move(tag)});
+            }
+            return std::unexpected<Error>({Error::Type::NOT_BINDABLE, std::move(tag)});
+        }
+        getRules(argument->index()).values.push_back([bound, p_check, p_type, tag]()->std::expected<void, Error>{
+            if(!bound->checkBound(p_check)) return std::unexpected<Error>({p_type, tag});
+            return {};
+        });
+        m_constrained = true;
+        return {};
+    } // #END: addValueCheck(const std::string_view, const std::function<bool(const T_Bind&)>&, const Error::Type)
+
 // #END: Parser
 
 } // #END: simpleCli
@@ -0,0 +1,87 @@
+#pragma once
+
+#if defined(SIMPLE_CLI_USE_MODULES) && defined(INCLUDED_BY_MODULE)
+    #define MODULE_EXPORT export
+#else
+    #include "simpleCli.hpp" // #INCLUDE: simpleCli.hpp, Project Header
+    #include "parser.hpp" // #INCLUDE: parser.hpp, Module Header
+    #include "errors.hpp" // #INCLUDE: errors.hpp, Module Header
+    #define MODULE_EXPORT
+#endif
+
+namespace simpleCli{ // #SCOPE: simpleCli
+
+    // #CLASS: Reloadable<T_Config>, Template Final Class
+    // Publishes each validated parse as an immutable snapshot, readers never lock
+    MODULE_EXPORT template<class T_Config> class Reloadable final{
+    public:
+    // Public Types
+        class Reader;
+        using Definition = std::function<std::expected<void, Error>(Parser&, T_Config&)>;
+        using Validator = std::function<std::expected<void, Error>(const T_Config&)>;
+    // Public Factory Methods
+        Reloadable() = default;
+        ~Reloadable() = default;
+        Reloadable(const Reloadable&) = delete;
+        Reloadable& operator=(const Reloadable&) = delete;
+    // Public Methods
+        std::expected<void, Error> define(const Definition& p_definition);
+        void setValidator(const Validator& p_validator);
+        std::expected<void, Error> reload(const int argc, char** const argv);
+        std::expected<void, Error> reload(const std::vector<std::string>& p_commandLine);
+        Reader read()const noexcept;
+        std::size_t reclaim();
+    // Public Members
+        static inline constexpr std::size_t MAX_READERS = 64; // Readers alive at once, further ones wait for a free slot
+    private:
+    // Private Types
+        struct Snapshot{
+            T_Config config;
+            std::vector<std::string> commandLine; // Owns the storage view binds point into
+        };
+        struct alignas(64) Slot{ // One cache line each so readers on different threads never share a line
+            std::atomic<bool> claimed = false; // Owned by one Reader
+            std::atomic<const Snapshot*> hazard = nullptr; // Snapshot the owning Reader holds
+        };
+    // Private Methods
+        std::expected<void, Error> parse(std::unique_ptr<Snapshot>&& p_snapshot);
+        void publish(std::unique_ptr<Snapshot>&& p_snapshot);
+        std::size_t reclaimRetired();
+        Slot& claimSlot()const noexcept;
+    // Private Members
+        Parser m_parser; // Bound to m_staging
+        T_Config m_staging; // Parse target, only touched under m_reloadMutex
+        T_Config m_defaults; // Staging state right after definition
+        Validator m_validator; // Optional whole config check
+        std::atomic<const Snapshot*> m_current = nullptr; // Published snapshot
+        std::vector<std::unique_ptr<const Snapshot>> m_snapshots; // Retired snapshots followed by the current one
+        mutable std::array<Slot, MAX_READERS> m_slots; // Hazard slots, a retired snapshot is freed once no slot holds it
+        std::mutex m_reloadMutex; // Serializes writers only
+    // Friends
+        friend class Reader;
+    }; // #END: Reloadable<T_Config>
+
+    // #CLASS: Reloadable<T_Config>::Reader, Template Final Class
+    // Pins the snapshot it was created with until destroyed, other snapshots are freed freely meanwhile
+    MODULE_EXPORT template<class T_Config> class Reloadable<T_Config>::Reader final{
+    public:
+    // Public Factory Methods
+        explicit Reader(const Reloadable<T_Config>& p_owner)noexcept;
+        ~Reader();
+        Reader(const Reader&) = delete;
+        Reader& operator=(const Reader&) = delete;
+    // Public Methods
+        const T_Config& operator*()const noexcept;
+        const T_Config* operator->()const noexcept;
+        explicit operator bool()const noexcept;
+    private:
+    // Private Members
+        Slot* m_slot; // Hazard slot to release
+        const Snapshot* m_snapshot; // Null before define()
+    }; // #END: Reloadable<T_Config>::Reader
+
+} // #END: simpleCli
+
+#undef MODULE_EXPORT
+
+#include "reloadable.tpp" // #INCLUDE: reloadable.tpp, Template Implementation
@@ -0,0 +1,174 @@
+#pragma once
+
+#ifndef SIMPLE_CLI_USE_MODULES
+    #include "reloadable.hpp" // #INCLUDE: reloadable.hpp, Module Header
+#endif
+
+namespace simpleCli{ // #SCOPE: simpleCli
+
+// #SCOPE: Reloadable<T_Config>
+
+// #DIV: Public Methods
+
+    // #FUNCTION: define(const Definition&), Template Method
+    template<class T_Config> std::expected<void, Error> Reloadable<T_Config>::define(const Definition& p_definition){
+        std::lock_guard<std::mutex> lock(m_reloadMutex);
+        if(!p_definition){
+            return std::unexpected<Error>({Error::Type::NULL_CALLBACK, "Reloadable Definition"});
+        }
+        if(auto result = p_definition(m_parser, m_staging); !result){
+            return result;
+        }
+        m_defaults = m_staging; // Registration may assign defaults
+        auto snapshot = std::make_unique<Snapshot>();
+        snapshot->config = m_defaults;
+        publish(std::move(snapshot));
+        return {}; // Success return void
+    } // #END: define(const Definition&)
+
+    // #FUNCTION: setValidator(const Validator&), Template Method
+    template<class T_Config> void Reloadable<T_Config>::setValidator(const Validator& p_validator){
+        std::lock_guard<std::mutex> lock(m_reloadMutex);
+        m_validator = p_validator;
+    } // #END: setValidator(const Validator&)
+
+    // #FUNCTION: reload(const int, char** const), Template Method
+    template<class T_Config> std::expected<void, Error> Reloadable<T_Config>::reload(const int argc, char** const argv){
+        if(argc < 1 || argv == nullptr){ // Empty or invalid command line
+            return std::unexpected<Error>(Error(Error::Type::INVALID_COMMAND_LINE));
+        }
+        auto snapshot = std::make_unique<Snapshot>();
+        snapshot->commandLine.assign(argv, argv + argc);
+        return parse(std::move(snapshot));
+    } // #END: reload(const int, char** const)
+
+    // #FUNCTION: reload(const std::vector<std::string>&), Template Method
+    template<class T_Config> std::expected<void, Error> Reloadable<T_Config>::reload(const std::vector<std::string>& p_commandLine){
+        auto snapshot = std::make_unique<Snapshot>();
+        snapshot->commandLine = p_commandLine;
+        return parse(std::move(snapshot));
+    } // #END: reload(const std::vector<std::string>&)
+
+    // #FUNCTION: read(), Const Noexcept Method
+    template<class T_Config> typename Reloadable<T_Config>::Reader Reloadable<T_Config>::read()const noexcept{
+        return Reader(*this);
+    } // #END: read()
+
+    // #FUNCTION: reclaim(), Template Method
+    template<class T_Config> std::size_t Reloadable<T_Config>::reclaim(){
+        std::lock_guard<std::mutex> lock(m_reloadMutex);
+        return reclaimRetired();
+    } // #END: reclaim()
+
+// #DIV: Private Methods
+
+    // #FUNCTION: parse(std::unique_ptr<Snapshot>&&), Template Method
+    template<class T_Config> std::expected<void, Error> Reloadable<T_Config>::parse(std::unique_ptr<Snapshot>&& p_snapshot){
+        std::lock_guard<std::mutex> lock(m_reloadMutex);
+        std::vector<char*> argv;
+        argv.reserve(p_snapshot->commandLine.size());
+        for(std::string& arg: p_snapshot->commandLine){
+            argv.push_back(arg.data()); // View binds end up pointing into the snapshot
+        }
+        m_staging = m_defaults; // Options not given fall back to defaults, not previous values
+        if(auto result = m_parser.parse(static_cast<int>(argv.size()), argv.data()); !result){
+            return std::unexpected<Error>(result.error());
+        }
+        if(m_validator){
+            if(auto result = m_validator(m_staging); !result){
+                return result;
+            }
+        }
+        p_snapshot->config = m_staging;
+        publish(std::move(p_snapshot));
+        reclaimRetired(); // At most MAX_READERS retired snapshots survive, one per live Reader
+        return {}; // Success return void
+    } // #END: parse(std::unique_ptr<Snapshot>&&)
+
+    // #FUNCTION: publish(std::unique_ptr<Snapshot>&&), Template Method
+    template<class T_Config> void Reloadable<T_Config>::publish(std::unique_ptr<Snapshot>&& p_snapshot){
+        static_assert(std::atomic<const Snapshot*>::is_always_lock_free, "Snapshot publication must be lock-free");
+        const Snapshot* snapshot = p_snapshot.get();
+        m_snapshots.push_back(std::move(p_snapshot)); // Old snapshots stay alive for in-flight readers
+        m_current.store(snapshot, std::memory_order_seq_cst); // Ordered before the hazard scan in reclaimRetired()
+    } // #END: publish(std::unique_ptr<Snapshot>&&)
+
+    // #FUNCTION: reclaimRetired(), Template Method
+    template<class T_Config> std::size_t Reloadable<T_Config>::reclaimRetired(){
+        if(m_snapshots.size() <= 1){
+            return 0;
+        }
+        std::array<const Snapshot*, MAX_READERS> hazards;
+        for(std::size_t i = 0; i < MAX_READERS; ++i){
+            // A reader whose hazard is missed here re-checks m_current afterwards and sees the new snapshot
+            hazards[i] = m_slots[i].hazard.load(std::memory_order_seq_cst);
+        }
+        const auto retiredEnd = m_snapshots.end() - 1; // The current snapshot is never retired
+        const auto kept = std::remove_if(m_snapshots.begin(), retiredEnd, [&hazards](const std::unique_ptr<const Snapshot>& p_snapshot){
+            return std::find(hazards.begin(), hazards.end(), p_snapshot.get()) == hazards.end();
+        });
+        const std::size_t freed = static_cast<std::size_t>(retiredEnd - kept);
+        m_snapshots.erase(kept, retiredEnd);
+        return freed;
+    } // #END: reclaimRetired()
+
+    // #FUNCTION: claimSlot(), Const Noexcept Method
+    template<class T_Config> typename Reloadable<T_Config>::Slot& Reloadable<T_Config>::claimSlot()const noexcept{
+        thread_local const std::size_t start = std::hash<std::thread::id>{}(std::this_thread::get_id()); // Threads start on different slots
+        for(std::size_t i = 0; ; ++i){
+            Slot& slot = m_slots[(start + i) % MAX_READERS];
+            if(!slot.claimed.load(std::memory_order_relaxed) && !slot.claimed.exchange(true, std::memory_order_acquire)){
+                return slot;
+            }
+            if(i % MAX_READERS == MAX_READERS - 1){
+                std::this_thread::yield(); // Every slot is taken, wait for a Reader to finish
+            }
+        }
+    } // #END: claimSlot()
+
+// #END: Reloadable<T_Config>
+
+// #SCOPE: Reloadable<T_Config>::Reader
+
+// #DIV: Public Factory Methods
+
+    // #FUNCTION: Reader(const Reloadable<T_Config>&), Noexcept Template Constructor
+    template<class T_Config> Reloadable<T_Config>::Reader::Reader(const Reloadable<T_Config>& p_owner)noexcept{
+        m_slot = &p_owner.claimSlot();
+        m_snapshot = p_owner.m_current.load(std::memory_order_seq_cst);
+        while(m_snapshot != nullptr){ // Publish the hazard, then confirm the snapshot was not retired before it became visible
+            m_slot->hazard.store(m_snapshot, std::memory_order_seq_cst);
+            const Snapshot* current = p_owner.m_current.load(std::memory_order_seq_cst);
+            if(current == m_snapshot){
+                break;
+            }
+            m_snapshot = current;
+        }
+    } // #END: Reader(const Reloadable<T_Config>&)
+
+    // #FUNCTION: ~Reader(), Template Destructor
+    template<class T_Config> Reloadable<T_Config>::Reader::~Reader(){
+        m_slot->hazard.store(nullptr, std::memory_order_release); // Reads of the snapshot happen before it can be freed
+        m_slot->claimed.store(false, std::memory_order_release);
+    } // #END: ~Reader()
+
+// #DIV: Public Methods
+
+    // #FUNCTION: operator*(), Const Noexcept Method
+    template<class T_Config> const T_Config& Reloadable<T_Config>::Reader::operator*()const noexcept{
+        return m_snapshot->config;
+    } // #END: operator*()
+
+    // #FUNCTION: operator->(), Const Noexcept Method
+    template<class T_Config> const T_Config* Reloadable<T_Config>::Reader::operator->()const noexcept{
+        return &m_snapshot->config;
+    } // #END: operator->()
+
+    // #FUNCTION: operator bool(), Const Noexcept Method
+    template<class T_Config> Reloadable<T_Config>::Reader::operator bool()const noexcept{
+        return m_snapshot != nullptr;
+    } // #END: operator bool()
+
+// #END: Reloadable<T_Config>::Reader
+
+} // #END: simpleCli
@@ -0,0 +1,49 @@
+#pragma once
+
+#if defined(SIMPLE_CLI_USE_MODULES) && defined(INCLUDED_BY_MODULE)
+    #define MODULE_EXPORT export
+#else
+    #include "simpleCli.hpp" // #INCLUDE: simpleCli.hpp, Project Header
+    #include "arguments.hpp" // #INCLUDE: arguments.hpp, Module Header
+    #include "parser.hpp" // #INCLUDE: parser.hpp, Module Header
+    #include "errors.hpp" // #INCLUDE: errors.hpp, Module Header
+    #define MODULE_EXPORT
+#endif
+
+namespace simpleCli{ // #SCOPE: simpleCli
+
+    // #CLASS: Schema<T_Config>, Template Final Class
+    // Registers fields once as member pointers, each parse fills the T_Config it is given
+    MODULE_EXPORT template<class T_Config> class Schema final{
+    private:
+    // Private Types
+        template<class T_Pointer> struct Member; // Only pointers to members of T_Config
+        template<class T_Bind> struct Member<T_Bind T_Config::*>{
+            using Type = T_Bind;
+        };
+        template<auto T_Field> using FieldType = typename Member<decltype(T_Field)>::Type;
+        template<auto T_Field> using ElementType = typename FieldType<T_Field>::value_type;
+    public:
+    // Public Factory Methods
+        Schema() = default;
+        ~Schema() = default;
+        Schema(const Schema&) = delete;
+        Schema& operator=(const Schema&) = delete;
+    // Public Methods
+        template<auto T_Field> std::expected<void, Error> addFlag(const std::initializer_list<std::string_view> p_tags);
+        template<auto T_Field> std::expected<void, Error> addOption(const std::initializer_list<std::string_view> p_tags, const Converter<FieldType<T_Field>>& p_converter = Argument::bindConverter<FieldType<T_Field>>());
+        template<auto T_Field> std::expected<void, Error> addRepeatableOption(const std::initializer_list<std::string_view> p_tags, const Converter<ElementType<T_Field>>& p_converter = Argument::bindConverter<ElementType<T_Field>>());
+        std::expected<ParseResult, Error> parse(const int argc, char** const argv, T_Config& p_config);
+        std::expected<ParseResult, Error> parse(const std::string_view p_commandLine, T_Config& p_config);
+        Parser& parser()noexcept;
+    private:
+    // Private Members
+        Parser m_parser; // Holds the field arguments, shared by every parse
+        T_Config* m_target = nullptr; // Config being filled, only set during parse
+    }; // #END: Schema<T_Config>
+
+} // #END: simpleCli
+
+#undef MODULE_EXPORT
+
+#include "schema.tpp" // #INCLUDE: schema.tpp, Template Implementation
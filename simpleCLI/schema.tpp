@@ -0,0 +1,53 @@
+#pragma once
+
+#ifndef SIMPLE_CLI_USE_MODULES
+    #include "schema.hpp" // #INCLUDE: schema.hpp, Module Header
+#endif
+
+namespace simpleCli{ // #SCOPE: simpleCli
+
+// #SCOPE: Schema<T_Config>
+
+// #DIV: Public Methods
+
+    // #FUNCTION: addFlag<T_Field>(const std::initializer_list<std::string_view>), Template Method
+    template<class T_Config> template<auto T_Field> std::expected<void, Error> Schema<T_Config>::addFlag(const std::initializer_list<std::string_view> p_tags){
+        static_assert(std::same_as<FieldType<T_Field>, bool>, "Flag fields must be bool");
+        return m_parser.template addArgument<FieldFlag<T_Config>>(p_tags, &m_target, T_Field);
+    } // #END: addFlag<T_Field>(const std::initializer_list<std::string_view>)
+
+    // #FUNCTION: addOption<T_Field>(const std::initializer_list<std::string_view>, const Converter<FieldType<T_Field>>&), Template Method
+    template<class T_Config> template<auto T_Field> std::expected<void, Error> Schema<T_Config>::addOption(const std::initializer_list<std::string_view> p_tags, const Converter<FieldType<T_Field>>& p_converter){
+        return m_parser.template addArgument<FieldOption<T_Config, FieldType<T_Field>>>(p_tags, &m_target, T_Field, p_converter);
+    } // #END: addOption<T_Field>(const std::initializer_list<std::string_view>, const Converter<FieldType<T_Field>>&)
+
+    // #FUNCTION: addRepeatableOption<T_Field>(const std::initializer_list<std::string_view>, const Converter<ElementType<T_Field>>&), Template Method
+    template<class T_Config> template<auto T_Field> std::expected<void, Error> Schema<T_Config>::addRepeatableOption(const std::initializer_list<std::string_view> p_tags, const Converter<ElementType<T_Field>>& p_converter){
+        static_assert(std::same_as<FieldType<T_Field>, std::vector<ElementType<T_Field>>>, "Repeatable option fields must be std::vector");
+        return m_parser.template addArgument<FieldRepeatableOption<T_Config, ElementType<T_Field>>>(p_tags, &m_target, T_Field, p_converter);
+    } // #END: addRepeatableOption<T_Field>(const std::initializer_list<std::string_view>, const Converter<ElementType<T_Field>>&)
+
+    // #FUNCTION: parse(const int, char** const, T_Config&), Template Method
+    template<class T_Config> std::expected<ParseResult, Error> Schema<T_Config>::parse(const int argc, char** const argv, T_Config& p_config){
+        m_target = &p_config;
+        auto result = m_parser.parse(argc, argv);
+        m_target = nullptr; // Never leave a dangling target between parses
+        return result;
+    } // #END: parse(const int, char** const, T_Config&)
+
+    // #FUNCTION: parse(const std::string_view, T_Config&), Template Method
+    template<class T_Config> std::expected<ParseResult, Error> Schema<T_Config>::parse(const std::string_view p_commandLine, T_Config& p_config){
+        m_target = &p_config;
+        auto result = m_parser.parse(p_commandLine);
+        m_target = nullptr;
+        return result;
+    } // #END: parse(const std::string_view, T_Config&)
+
+    // #FUNCTION: parser(), Noexcept Method
+    template<class T_Config> Parser& Schema<T_Config>::parser()noexcept{
+        return m_parser;
+    } // #END: parser()
+
+// #END: Schema<T_Config>
+
+} // #END: simpleCli
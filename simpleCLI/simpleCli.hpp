@@ -20,18 +20,31 @@ namespace simpleCli{
 
     struct Error;
 
+    class ViewConverter;
     class Argument;
     class Flag;
     class Flaggable;
     class Bindable;
     class Callable;
+    template<class T_Bind> class Bound;
     template<class T_Bind> class Option;
     template<class T_Bind> class RepeatableOption;
     template<class T_Bind> class ContinuousOption;
     template<class T_Call> class Command;
     template<class T_Bind> class Positional;
+    template<class T_Bind> class StreamedPositional;
+    template<class T_Bind> class PositionalSource;
+    template<class T_Bind> class PositionalStream;
     template<class T_Bind> class Program;
+    template<class T_Config> class FieldFlag;
+    template<class T_Config, class T_Bind> class FieldOption;
+    template<class T_Config, class T_Bind> class FieldRepeatableOption;
 
+    struct ParseResult;
     class Parser;
+    template<class T_Config> class Reloadable;
+    template<class T_Config> class Schema;
+    template<class T_Signature, std::size_t T_Capacity> class StaticFunction;
+    template<std::size_t T_MaxTags, std::size_t T_MaxTokens> class StaticParser;
 
 } // #END: simpleCli
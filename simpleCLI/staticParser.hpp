@@ -0,0 +1,82 @@
+#pragma once
+
+#if defined(SIMPLE_CLI_USE_MODULES) && defined(INCLUDED_BY_MODULE)
+    #define MODULE_EXPORT export
+#else
+    #include "simpleCli.hpp" // #INCLUDE: simpleCli.hpp, Project Header
+    #include "arguments.hpp" // #INCLUDE: arguments.hpp, Module Header
+    #include "parser.hpp" // #INCLUDE: parser.hpp, Module Header
+    #include "errors.hpp" // #INCLUDE: errors.hpp, Module Header
+    #define MODULE_EXPORT
+#endif
+
+namespace simpleCli{ // #SCOPE: simpleCli
+
+    // #CLASS: StaticFunction<T_Return(T_Args...), T_Capacity>, Template Final Class
+    // Callable stored inline, only trivially copyable callables that fit T_Capacity are accepted
+    MODULE_EXPORT template<class T_Signature, std::size_t T_Capacity = 4 * sizeof(void*)> class StaticFunction;
+    MODULE_EXPORT template<class T_Return, class... T_Args, std::size_t T_Capacity> class StaticFunction<T_Return(T_Args...), T_Capacity> final{
+    public:
+    // Public Factory Methods
+        StaticFunction() = default;
+        template<class T_Callable> requires (!std::same_as<T_Callable, StaticFunction> && std::invocable<const T_Callable&, T_Args...>) StaticFunction(const T_Callable& p_callable);
+    // Public Methods
+        T_Return operator()(T_Args... p_args)const;
+        explicit operator bool()const noexcept;
+    private:
+    // Private Static Methods
+        template<class T_Callable> static T_Return invoke(const std::byte* const p_storage, T_Args... p_args);
+    // Private Members
+        alignas(std::max_align_t) std::array<std::byte, T_Capacity> m_storage{};
+        T_Return (*m_invoke)(const std::byte* const, T_Args...) = nullptr; // Null when empty
+    }; // #END: StaticFunction<T_Return(T_Args...), T_Capacity>
+
+    MODULE_EXPORT template<class T_Arg> using StaticConverter = StaticFunction<std::expected<T_Arg, Error>(const std::string_view)>;
+
+    // #CLASS: StaticParser<T_MaxTags, T_MaxTokens>, Template Final Class
+    // Parser with inline fixed capacity storage, never allocates unless reporting an Error
+    MODULE_EXPORT template<std::size_t T_MaxTags, std::size_t T_MaxTokens> class StaticParser final{
+    public:
+    // Public Factory Methods
+        StaticParser() = default;
+        ~StaticParser() = default;
+    // Public Methods
+        std::expected<ParseResult, Error> parse(const int argc, char** const argv)const;
+        std::expected<void, Error> addFlag(const std::initializer_list<std::string_view> p_tags, bool& p_bind);
+        std::expected<void, Error> addFlag(const std::initializer_list<std::string_view> p_tags, const StaticFunction<void()>& p_callback);
+        std::expected<void, Error> addFlag(const std::initializer_list<std::string_view> p_tags, bool& p_bind, const StaticFunction<void()>& p_callback);
+        template<class T_Bind> std::expected<void, Error> addOption(const std::initializer_list<std::string_view> p_tags, T_Bind& p_bind, const StaticConverter<T_Bind>& p_converter = &Argument::convertView<T_Bind>);
+        template<class T_Bind> std::expected<void, Error> addOption(const std::initializer_list<std::string_view> p_tags, T_Bind& p_bind, const T_Bind& p_default, const StaticConverter<T_Bind>& p_converter = &Argument::convertView<T_Bind>);
+        template<class T_Bind> void addPositional(const std::span<T_Bind> p_bind, std::size_t& p_count, const StaticConverter<T_Bind>& p_converter = &Argument::convertView<T_Bind>);
+    // Public Members
+        static inline constexpr std::size_t MAX_TAG_SIZE = 32;
+    private:
+    // Private Types
+        enum class Kind: std::uint8_t{
+            FLAG,
+            OPTION
+        };
+        using Binder = StaticFunction<std::expected<void, Error>(const std::string_view), 4 * sizeof(void*) + sizeof(StaticConverter<int>)>; // Converter plus bind target
+        struct Record{
+            std::array<char, MAX_TAG_SIZE> tag{}; // Not null terminated
+            std::uint8_t size = 0;
+            Kind kind = Kind::FLAG;
+            bool* flag = nullptr;
+            StaticFunction<void()> callback;
+            Binder binder;
+        };
+    // Private Methods
+        std::expected<void, Error> addRecords(const std::initializer_list<std::string_view> p_tags, const Record& p_record);
+        const Record* getRecord(const std::string_view p_tag)const;
+    // Private Members
+        std::array<Record, T_MaxTags> m_records{}; // One record per tag
+        std::size_t m_size = 0; // Records in use
+        Binder m_positionals; // Empty when positionals are not supported
+        std::size_t* m_positionalCount = nullptr; // Reset on every parse
+    }; // #END: StaticParser<T_MaxTags, T_MaxTokens>
+
+} // #END: simpleCli
+
+#undef MODULE_EXPORT
+
+#include "staticParser.tpp" // #INCLUDE: staticParser.tpp, Template Implementation
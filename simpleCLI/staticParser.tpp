@@ -0,0 +1,255 @@
+#pragma once
+
+#ifndef SIMPLE_CLI_USE_MODULES
+    #include "staticParser.hpp" // #INCLUDE: staticParser.hpp, Module Header
+#endif
+
+namespace simpleCli{ // #SCOPE: simpleCli
+
+// #SCOPE: StaticFunction<T_Return(T_Args...), T_Capacity>
+
+// #DIV: Public Factory Methods
+
+    // #FUNCTION: StaticFunction<T_Callable>(const T_Callable&), Template Constructor
+    template<class T_Return, class... T_Args, std::size_t T_Capacity> template<class T_Callable> requires (!std::same_as<T_Callable, StaticFunction<T_Return(T_Args...), T_Capacity>> && std::invocable<const T_Callable&, T_Args...>) StaticFunction<T_Return(T_Args...), T_Capacity>::StaticFunction(const T_Callable& p_callable){
+        static_assert(sizeof(T_Callable) <= T_Capacity, "Callable does not fit the inline storage");
+        static_assert(alignof(T_Callable) <= alignof(std::max_align_t), "Callable is over aligned");
+        static_assert(std::is_trivially_copyable_v<T_Callable> && std::is_trivially_destructible_v<T_Callable>, "Callable must be trivially copyable, capture by reference or pointer");
+        ::new(static_cast<void*>(m_storage.data())) T_Callable(p_callable);
+        m_invoke = &invoke<T_Callable>;
+    } // #END: StaticFunction<T_Callable>(const T_Callable&)
+
+// #DIV: Public Methods
+
+    // #FUNCTION: operator()(T_Args...), Const Method
+    template<class T_Return, class... T_Args, std::size_t T_Capacity> T_Return StaticFunction<T_Return(T_Args...), T_Capacity>::operator()(T_Args... p_args)const{
+        return m_invoke(m_storage.data(), std::forward<T_Args>(p_args)...);
+    } // #END: operator()(T_Args...)
+
+    // #FUNCTION: operator bool(), Const Noexcept Method
+    template<class T_Return, class... T_Args, std::size_t T_Capacity> StaticFunction<T_Return(T_Args...), T_Capacity>::operator bool()const noexcept{
+        return m_invoke != nullptr;
+    } // #END: operator bool()
+
+// #DIV: Private Static Methods
+
+    // #FUNCTION: invoke<T_Callable>(const std::byte* const, T_Args...), Template Static Method
+    template<class T_Return, class... T_Args, std::size_t T_Capacity> template<class T_Callable> T_Return StaticFunction<T_Return(T_Args...), T_Capacity>::invoke(const std::byte* const p_storage, T_Args... p_args){
+        return (*std::launder(reinterpret_cast<const T_Callable*>(p_storage)))(std::forward<T_Args>(p_args)...);
+    } // #END: invoke<T_Callable>(const std::byte* const, T_Args...)
+
+// #END: StaticFunction<T_Return(T_Args...), T_Capacity>
+
+// #SCOPE: StaticParser<T_MaxTags, T_MaxTokens>
+
+// #DIV: Public Methods
+
+    // #FUNCTION: parse(const int, char** const), Const Template Method
+    template<std::size_t T_MaxTags, std::size_t T_MaxTokens> std::expected<ParseResult, Error> StaticParser<T_MaxTags, T_MaxTokens>::parse(const int argc, char** const argv)const{
+        if(argc < 1 || argv == nullptr){ // Empty or invalid command line
+            return std::unexpected<Error>(Error(Error::Type::INVALID_COMMAND_LINE));
+        }
+        // Flags and positionals describe only this command line, options keep their value until given again
+        for(std::size_t position = 0; position < m_size; position++){
+            if(m_records[position].flag){
+                *m_records[position].flag = false;
+            }
+        }
+        if(m_positionalCount){
+            *m_positionalCount = 0; // Positionals are written from the start of the span
+        }
+        ParseResult parseResult;
+        if(argc == 1){ // No arguments provided
+            return parseResult;
+        }
+        parseResult.parsed = true;
+        int last = argc;
+        for(int position = 1; position < argc; position++){
+            if(std::string_view(argv[position]) == Parser::END_OF_OPTIONS){ // Terminator is dropped
+                last = position;
+                parseResult.stopped = true;
+                parseResult.remainder = std::span<char*>(argv + position + 1, argv + argc);
+                break;
+            }
+        }
+        // Split inline values into a token array on the stack, malformed assignments fail before anything is bound
+        // A value that fails to convert later still leaves the binds before it written
+        std::array<std::string_view, T_MaxTokens> tokens;
+        std::size_t size = 0;
+        for(int position = 1; position < last; position++){
+            std::string_view arg = argv[position];
+            std::string_view value;
+            if(arg.empty()){ // Skip empty arg
+                continue;
+            }
+            if(auto it = arg.find(Parser::OPTION_VALUE_SEPARATOR); it != std::string_view::npos){ // Has inline value
+                const std::string_view tag = arg.substr(0, it);
+                if(const Record* record = getRecord(tag)){ // Known tag with inline assignment
+                    if(record->kind != Kind::OPTION){
+                        return std::unexpected<Error>({Error::Type::ARGUMENT_DOES_NOT_TAKE_VALUE, std::string(arg)});
+                    }
+                    value = arg.substr(it + 1); // A suffix of the argv entry
+                    if(value.empty()){
+                        return std::unexpected<Error>({Error::Type::EMPTY_OPTION_VALUE, std::string(arg)});
+                    }
+                    if(getRecord(value)){ // Value is a tag
+                        return std::unexpected<Error>({Error::Type::INVALID_INLINE_ASSIGNMENT, std::string(arg)});
+                    }
+                    arg = tag;
+                }else if(tag.empty()){ // Dangling '=' at start
+                    return std::unexpected<Error>({Error::Type::EMPTY_OPTION_TAG, std::string(arg)});
+                }
+            }
+            if(T_MaxTokens - size < (value.empty() ? 1 : 2)){
+                return std::unexpected<Error>({Error::Type::CAPACITY_EXCEEDED, "Tokens"});
+            }
+            tokens[size++] = arg;
+            if(!value.empty()){
+                tokens[size++] = value;
+            }
+        }
+        const Record* previous = nullptr; // Option still waiting for its value
+        for(std::size_t position = 0; position < size; position++){
+            const std::string_view arg = tokens[position];
+            if(const Record* record = getRecord(arg)){ // Is a known tag
+                if(previous){ // Previous was option that was not given a value
+                    return std::unexpected<Error>({Error::Type::NO_VALUE_PROVIDED, std::string(previous->tag.data(), previous->size)});
+                }
+                if(record->kind == Kind::FLAG){
+                    if(record->flag){
+                        *record->flag = true;
+                    }
+                    if(record->callback){
+                        record->callback();
+                    }
+                }else{
+                    previous = record;
+                }
+            }else if(previous || m_positionals){ // Option value or positional
+                if(!Parser::isValidValue(arg)){
+                    return std::unexpected<Error>({Error::Type::INVALID_VALUE, std::string(arg)});
+                }
+                if(auto result = previous ? previous->binder(arg) : m_positionals(arg); !result){
+                    return std::unexpected<Error>(result.error());
+                }
+                previous = nullptr;
+            }else{
+                return std::unexpected<Error>({Error::Type::POSITIONALS_NOT_SUPPORTED, std::string(arg)});
+            }
+        }
+        if(previous){ // Last option was not given a value
+            return std::unexpected<Error>({Error::Type::NO_VALUE_PROVIDED, std::string(previous->tag.data(), previous->size)});
+        }
+        return parseResult; // Successfully parsed arguments
+    } // #END: parse(const int, char** const)
+
+    // #FUNCTION: addFlag(const std::initializer_list<std::string_view>, bool&), Template Method
+    template<std::size_t T_MaxTags, std::size_t T_MaxTokens> std::expected<void, Error> StaticParser<T_MaxTags, T_MaxTokens>::addFlag(const std::initializer_list<std::string_view> p_tags, bool& p_bind){
+        p_bind = false;
+        Record record;
+        record.flag = &p_bind;
+        return addRecords(p_tags, record);
+    } // #END: addFlag(const std::initializer_list<std::string_view>, bool&)
+
+    // #FUNCTION: addFlag(const std::initializer_list<std::string_view>, const StaticFunction<void()>&), Template Method
+    template<std::size_t T_MaxTags, std::size_t T_MaxTokens> std::expected<void, Error> StaticParser<T_MaxTags, T_MaxTokens>::addFlag(const std::initializer_list<std::string_view> p_tags, const StaticFunction<void()>& p_callback){
+        if(!p_callback){
+            return std::unexpected<Error>(Error(Error::Type::NULL_CALLBACK));
+        }
+        Record record;
+        record.callback = p_callback;
+        return addRecords(p_tags, record);
+    } // #END: addFlag(const std::initializer_list<std::string_view>, const StaticFunction<void()>&)
+
+    // #FUNCTION: addFlag(const std::initializer_list<std::string_view>, bool&, const StaticFunction<void()>&), Template Method
+    template<std::size_t T_MaxTags, std::size_t T_MaxTokens> std::expected<void, Error> StaticParser<T_MaxTags, T_MaxTokens>::addFlag(const std::initializer_list<std::string_view> p_tags, bool& p_bind, const StaticFunction<void()>& p_callback){
+        if(!p_callback){
+            return std::unexpected<Error>(Error(Error::Type::NULL_CALLBACK));
+        }
+        p_bind = false;
+        Record record;
+        record.flag = &p_bind;
+        record.callback = p_callback;
+        return addRecords(p_tags, record);
+    } // #END: addFlag(const std::initializer_list<std::string_view>, bool&, const StaticFunction<void()>&)
+
+    // #FUNCTION: addOption<T_Bind>(const std::initializer_list<std::string_view>, T_Bind&, const StaticConverter<T_Bind>&), Template Method
+    template<std::size_t T_MaxTags, std::size_t T_MaxTokens> template<class T_Bind> std::expected<void, Error> StaticParser<T_MaxTags, T_MaxTokens>::addOption(const std::initializer_list<std::string_view> p_tags, T_Bind& p_bind, const StaticConverter<T_Bind>& p_converter){
+        if(!p_converter){
+            return std::unexpected<Error>({Error::Type::NULL_BIND_OR_CONVERTER, "Static Option"});
+        }
+        Record record;
+        record.kind = Kind::OPTION;
+        record.binder = [bind = &p_bind, p_converter](const std::string_view p_value)->std::expected<void, Error>{
+            auto result = p_converter(p_value);
+            if(!result){
+                return std::unexpected<Error>(result.error());
+            }
+            *bind = std::move(result.value());
+            return {}; // Success return void
+        };
+        return addRecords(p_tags, record);
+    } // #END: addOption<T_Bind>(const std::initializer_list<std::string_view>, T_Bind&, const StaticConverter<T_Bind>&)
+
+    // #FUNCTION: addOption<T_Bind>(const std::initializer_list<std::string_view>, T_Bind&, const T_Bind&, const StaticConverter<T_Bind>&), Template Method
+    template<std::size_t T_MaxTags, std::size_t T_MaxTokens> template<class T_Bind> std::expected<void, Error> StaticParser<T_MaxTags, T_MaxTokens>::addOption(const std::initializer_list<std::string_view> p_tags, T_Bind& p_bind, const T_Bind& p_default, const StaticConverter<T_Bind>& p_converter){
+        p_bind = p_default;
+        return addOption(p_tags, p_bind, p_converter);
+    } // #END: addOption<T_Bind>(const std::initializer_list<std::string_view>, T_Bind&, const T_Bind&, const StaticConverter<T_Bind>&)
+
+    // #FUNCTION: addPositional<T_Bind>(const std::span<T_Bind>, std::size_t&, const StaticConverter<T_Bind>&), Template Method
+    template<std::size_t T_MaxTags, std::size_t T_MaxTokens> template<class T_Bind> void StaticParser<T_MaxTags, T_MaxTokens>::addPositional(const std::span<T_Bind> p_bind, std::size_t& p_count, const StaticConverter<T_Bind>& p_converter){
+        p_count = 0;
+        m_positionalCount = &p_count;
+        m_positionals = [bind = p_bind, count = &p_count, p_converter](const std::string_view p_value)->std::expected<void, Error>{
+            if(*count == bind.size()){
+                return std::unexpected<Error>({Error::Type::CAPACITY_EXCEEDED, "Positionals"});
+            }
+            auto result = p_converter(p_value);
+            if(!result){
+                return std::unexpected<Error>(result.error());
+            }
+            bind[(*count)++] = std::move(result.value());
+            return {}; // Success return void
+        };
+    } // #END: addPositional<T_Bind>(const std::span<T_Bind>, std::size_t&, const StaticConverter<T_Bind>&)
+
+// #DIV: Private Methods
+
+    // #FUNCTION: addRecords(const std::initializer_list<std::string_view>, const Record&), Template Method
+    template<std::size_t T_MaxTags, std::size_t T_MaxTokens> std::expected<void, Error> StaticParser<T_MaxTags, T_MaxTokens>::addRecords(const std::initializer_list<std::string_view> p_tags, const Record& p_record){
+        if(p_tags.size() > T_MaxTags - m_size){ // Not enough records left for the whole group
+            return std::unexpected<Error>({Error::Type::CAPACITY_EXCEEDED, std::string(p_tags.size() ? *p_tags.begin() : std::string_view())});
+        }
+        for(auto it = p_tags.begin(); it != p_tags.end(); it++){
+            if(!Parser::isValidTag(*it)) return std::unexpected<Error>({Error::Type::INVALID_TAG, std::string(*it)});
+            if(getRecord(*it) || std::find(p_tags.begin(), it, *it) != it) return std::unexpected<Error>({Error::Type::REPEATED_TAG, std::string(*it)});
+            if(it->size() > MAX_TAG_SIZE) return std::unexpected<Error>({Error::Type::CAPACITY_EXCEEDED, std::string(*it)});
+        }
+        // Every tag is checked before any record is written, so a rejected group registers nothing
+        for(const std::string_view& tag: p_tags){
+            Record& record = m_records[m_size++];
+            record = p_record;
+            std::copy(tag.begin(), tag.end(), record.tag.begin());
+            record.size = static_cast<std::uint8_t>(tag.size());
+        }
+        return {};
+    } // #END: addRecords(const std::initializer_list<std::string_view>, const Record&)
+
+    // #FUNCTION: getRecord(const std::string_view), Const Template Method
+    template<std::size_t T_MaxTags, std::size_t T_MaxTokens> const typename StaticParser<T_MaxTags, T_MaxTokens>::Record* StaticParser<T_MaxTags, T_MaxTokens>::getRecord(const std::string_view p_tag)const{
+        if(p_tag.size() > MAX_TAG_SIZE){ // Cannot be a registered tag
+            return nullptr;
+        }
+        for(std::size_t position = 0; position < m_size; position++){ // Records are contiguous and few, a scan beats hashing
+            const Record& record = m_records[position];
+            if(record.size == p_tag.size() && std::memcmp(record.tag.data(), p_tag.data(), p_tag.size()) == 0){
+                return &record;
+            }
+        }
+        return nullptr;
+    } // #END: getRecord(const std::string_view)
+
+// #END: StaticParser<T_MaxTags, T_MaxTokens>
+
+} // #END: simpleCli
@@ -1,8 +1,11 @@
 #pragma once
 
 #include <map>
+#include <array>
+#include <set>
 #include <string>
 #include <vector>
+#include <deque>
 #include <functional>
 #include <optional>
 #include <memory>
@@ -11,6 +14,21 @@
 #include <initializer_list>
 #include <string_view>
 #include <unordered_map>
+#include <span>
 #include <utility>
 #include <concepts>
 #include <cstring>
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <bit>
+#include <charconv>
+#include <new>
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+    #include <emmintrin.h>
+#endif
@@ -0,0 +1,121 @@
+#include <cstdio>
+#include <cstdlib>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#ifdef SIMPLE_CLI_USE_MODULES
+import simpleCli;
+#else
+#include <simpleCli/simpleCli.hpp>
+#endif
+
+static int failures = 0;
+
+static void check(const bool p_condition, const char* const p_message){
+    if(!p_condition){
+        std::printf("FAILED: %s\n", p_message);
+        failures++;
+    }
+}
+
+// Splits p_line with the string overload and returns every positional after the program name
+static std::vector<std::string> tokenize(const std::string_view p_line){
+    simpleCli::Parser parser;
+    std::vector<std::string> positionals;
+    parser.addPositional(positionals);
+    if(!parser.parse(p_line)){
+        positionals.assign(1, "<error>");
+    }
+    return positionals;
+}
+
+// Returns the error of a string parse that is expected to fail
+static simpleCli::Error tokenizeError(const std::string_view p_line){
+    simpleCli::Parser parser;
+    std::vector<std::string> positionals;
+    parser.addPositional(positionals);
+    auto result = parser.parse(p_line);
+    return result ? simpleCli::Error() : result.error();
+}
+
+static void testTokenizer(){
+    using Tokens = std::vector<std::string>;
+    check(tokenize("prog  a \t b\n c ") == Tokens{"a", "b", "c"}, "whitespace runs separate tokens");
+    check(tokenize("prog 'a b' 'x\\y' '\"'") == Tokens{"a b", "x\\y", "\""}, "single quotes are literal");
+    check(tokenize("prog \"a b\" \"\\$\\`\\\"\\\\\" \"\\x\"") == Tokens{"a b", "$`\"\\", "\\x"}, "double quotes only unescape $ ` \" and \\");
+    check(tokenize("prog a\\ b \\'c\\' d\\\ne") == Tokens{"a b", "'c'", "de"}, "backslash escapes and line continuation");
+    check(tokenize("prog mix'ed'\"str\"ing") == Tokens{"mixedstring"}, "adjacent quoted parts join one token");
+    check(tokenize("prog '' \"\" x") == Tokens{"", "", "x"}, "quoted empty strings stay tokens");
+
+    simpleCli::Parser parser;
+    std::string name = "unset";
+    check(parser.addOption({"-n", "--name"}, name).has_value(), "register name option");
+    check(parser.parse(std::string_view("prog --name ''")).has_value() && name.empty(), "quoted empty value binds");
+    check(parser.parse(std::string_view("prog --name='a b'")).has_value() && name == "a b", "quoted inline value binds");
+
+    simpleCli::Error single = tokenizeError("prog 'abc");
+    check(single.type == simpleCli::Error::Type::UNTERMINATED_QUOTE && single.offset == 5, "unterminated single quote offset");
+    simpleCli::Error quoted = tokenizeError("prog a \"b\\\"");
+    check(quoted.type == simpleCli::Error::Type::UNTERMINATED_QUOTE && quoted.offset == 7, "unterminated double quote offset");
+    simpleCli::Error trailing = tokenizeError("prog \"ab\\");
+    check(trailing.type == simpleCli::Error::Type::UNTERMINATED_QUOTE && trailing.offset == 5, "escape at the end of a double quote");
+    simpleCli::Error dangling = tokenizeError("prog abc\\");
+    check(dangling.type == simpleCli::Error::Type::DANGLING_ESCAPE && dangling.offset == 8, "dangling escape offset");
+}
+
+// Returns the error type of a string parse, or nothing when it succeeds
+static std::optional<simpleCli::Error::Type> parseError(simpleCli::Parser& p_parser, const std::string_view p_line){
+    auto result = p_parser.parse(p_line);
+    return result ? std::nullopt : std::optional<simpleCli::Error::Type>(result.error().type);
+}
+
+static void testConstraints(){
+    using Type = simpleCli::Error::Type;
+    simpleCli::Parser parser;
+    std::string output;
+    bool all = false;
+    bool brief = false;
+    bool help = false;
+    int count = 0;
+    check(parser.addOption({"-o", "--output"}, output).has_value(), "register output option");
+    check(parser.addFlag({"-a", "--all"}, all).has_value(), "register all flag");
+    check(parser.addFlag({"-b", "--brief"}, brief).has_value(), "register brief flag");
+    check(parser.addFlag({"-h", "--help"}, help).has_value(), "register help flag");
+    check(parser.addOption({"-n", "--count"}, count).has_value(), "register count option");
+
+    check(parser.addRequired({"--output"}).has_value(), "register required by long tag");
+    check(parser.addConflict({"--all", "-b"}).has_value(), "register conflict across tag forms");
+    check(parser.addDependency("-n", {"--all"}).has_value(), "register dependency across tag forms");
+    check(parser.addRange("--count", 1, 5).has_value(), "register range on int option");
+    check(parser.setStopFlag({"--help"}).has_value(), "register stop flag");
+    auto mismatch = parser.addRange("-n", 1u, 5u);
+    check(!mismatch && mismatch.error().type == Type::TYPE_MISMATCH, "range of another type is a type mismatch");
+    auto missing = parser.addRequired({"--missing"});
+    check(!missing && missing.error().type == Type::INVALID_TAG, "constraint on an unknown tag");
+
+    check(!parseError(parser, "prog -o out"), "required satisfied by its short alias");
+    check(parseError(parser, "prog") == Type::MISSING_REQUIRED_ARGUMENT, "required with no arguments");
+    check(parseError(parser, "prog -a") == Type::MISSING_REQUIRED_ARGUMENT, "required missing among other arguments");
+    check(parseError(parser, "prog -o out --all --brief") == Type::CONFLICTING_ARGUMENTS, "conflict across aliases");
+    check(parseError(parser, "prog --output out -a -b") == Type::CONFLICTING_ARGUMENTS, "conflict across other aliases");
+    check(parseError(parser, "prog -o out --count 3") == Type::MISSING_DEPENDENCY, "dependency missing");
+    check(!parseError(parser, "prog -o out --count=3 -a") && count == 3, "dependency satisfied by its short alias");
+    check(parseError(parser, "prog -o out -n 9 --all") == Type::VALUE_OUT_OF_RANGE, "range checked through an alias");
+
+    auto stopped = parser.parse(std::string_view("prog -a -b -h -n 9"));
+    check(stopped.has_value() && stopped->stopped && help, "stop flag skips every constraint");
+    check(parseError(parser, "prog -h") == std::nullopt, "stop flag skips the required check");
+    check(parseError(parser, "prog -a -b") == Type::MISSING_REQUIRED_ARGUMENT, "constraints return without the stop flag");
+}
+
+int main(){
+    testTokenizer();
+    testConstraints();
+
+    if(failures == 0){
+        std::printf("All Parser checks passed\n");
+    }
+    return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,118 @@
+#include <array>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <span>
+#include <string_view>
+
+#ifdef SIMPLE_CLI_USE_MODULES
+import simpleCli;
+#else
+#include <simpleCli/simpleCli.hpp>
+#endif
+
+// Counts every global allocation so registration and parsing can be checked for zero
+static std::size_t allocations = 0;
+
+void* operator new(std::size_t p_size){
+    allocations++;
+    if(void* memory = std::malloc(p_size ? p_size : 1)){
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p_memory)noexcept{
+    std::free(p_memory);
+}
+
+void operator delete(void* p_memory, std::size_t)noexcept{
+    std::free(p_memory);
+}
+
+static int failures = 0;
+
+static void check(const bool p_condition, const char* const p_message){
+    if(!p_condition){
+        std::printf("FAILED: %s\n", p_message);
+        failures++;
+    }
+}
+
+int main(){
+    bool verbose = false;
+    bool help = false;
+    int count = 0;
+    float ratio = 0.0f;
+    std::string_view name;
+    int calls = 0;
+    std::array<int, 4> items{};
+    std::size_t itemCount = 0;
+
+    simpleCli::StaticParser<12, 16> parser;
+
+    std::size_t before = allocations;
+    check(parser.addFlag({"-v", "--verbose"}, verbose).has_value(), "register flag");
+    check(parser.addFlag({"-h", "--help"}, help, [&calls](){ calls++; }).has_value(), "register flag with callback");
+    check(parser.addOption({"-c", "--count"}, count, 3).has_value(), "register option with default");
+    check(parser.addOption({"-r"}, ratio).has_value(), "register float option");
+    check(parser.addOption({"-n", "--name"}, name).has_value(), "register view option");
+    parser.addPositional(std::span<int>(items), itemCount);
+    check(allocations == before, "registration does not allocate");
+
+    char program[] = "program";
+    char verboseFlag[] = "-v";
+    char countOption[] = "--count=42";
+    char ratioOption[] = "-r";
+    char ratioValue[] = "2.5";
+    char nameOption[] = "--name";
+    char nameValue[] = "abc";
+    char helpFlag[] = "-h";
+    char first[] = "7";
+    char second[] = "-8";
+    char* argv[] = {program, verboseFlag, countOption, ratioOption, ratioValue, nameOption, nameValue, helpFlag, first, second};
+
+    before = allocations;
+    auto result = parser.parse(10, argv);
+    auto again = parser.parse(10, argv);
+    check(allocations == before, "parsing does not allocate");
+
+    check(result.has_value() && again.has_value(), "parse succeeds");
+    check(verbose && help && calls == 2, "flags and callbacks");
+    check(count == 42 && ratio == 2.5f && name.data() == nameValue, "option values");
+    check(itemCount == 2 && items[0] == 7 && items[1] == -8, "positionals restart on every parse");
+
+    char* quiet[] = {program, first};
+    check(parser.parse(2, quiet).has_value() && !verbose && !help && itemCount == 1, "flags reset on every parse");
+
+    simpleCli::StaticParser<2, 2> small;
+    bool flag = false;
+    int value = 0;
+    check(small.addFlag({"-a", "-b"}, flag).has_value(), "fill tag capacity");
+    auto overflow = small.addOption({"-c"}, value);
+    check(!overflow && overflow.error().type == simpleCli::Error::Type::CAPACITY_EXCEEDED, "tag overflow is reported");
+    simpleCli::StaticParser<4, 4> groups;
+    int other = 0;
+    check(groups.addFlag({"-a"}, flag).has_value(), "register single flag");
+    auto repeated = groups.addOption({"-c", "-a"}, value);
+    check(!repeated && repeated.error().type == simpleCli::Error::Type::REPEATED_TAG, "repeated tag is reported");
+    auto partial = groups.addOption({"-d", "-e", "-f", "-g"}, other);
+    check(!partial && partial.error().type == simpleCli::Error::Type::CAPACITY_EXCEEDED, "group overflow is reported");
+    char c[] = "-c";
+    char d[] = "-d";
+    char five[] = "5";
+    char* rejectedC[] = {program, c, five};
+    char* rejectedD[] = {program, d, five};
+    check(!groups.parse(3, rejectedC) && !groups.parse(3, rejectedD) && value == 0 && other == 0, "rejected groups register no tag");
+    check(groups.addOption({"-c", "-d", "-e"}, value).has_value(), "rejected groups use no capacity");
+
+    char a[] = "-a";
+    char* tooMany[] = {program, a, a, a};
+    auto tokens = small.parse(4, tooMany);
+    check(!tokens && tokens.error().type == simpleCli::Error::Type::CAPACITY_EXCEEDED, "token overflow is reported");
+
+    if(failures == 0){
+        std::printf("All StaticParser checks passed\n");
+    }
+    return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}